@@ -2,6 +2,8 @@
 
 #include "async_command_exec.hpp"
 
+#include <sys/mman.h>
+
 #include <phosphor-logging/lg2.hpp>
 
 namespace data_sync::async
@@ -87,28 +89,79 @@ bool AsyncCommandExecutor::setupPipeRedirection(const FD& readFd,
     return true;
 }
 
-std::pair<pid_t, int> AsyncCommandExecutor::spawnCommand(const std::string& cmd,
-                                                         const auto& actions)
+FD AsyncCommandExecutor::setupStdinRedirection(const std::string& stdinData,
+                                               const auto& actions)
 {
-    const char* argv[] = {"/bin/sh", "-c", cmd.c_str(), nullptr};
+    FD stdinFd(memfd_create("data-sync-stdin", MFD_CLOEXEC));
+    if (stdinFd() < 0)
+    {
+        lg2::error("Failed to create the stdin file. Errno : {ERRNO}, "
+                   "Error : {MSG}",
+                   "ERRNO", errno, "MSG", strerror(errno));
+        return FD(-1);
+    }
+
+    size_t written = 0;
+    while (written < stdinData.size())
+    {
+        auto bytes = write(stdinFd(), stdinData.data() + written,
+                           stdinData.size() - written);
+        if (bytes < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            lg2::error("Failed to write the stdin data. Errno : {ERRNO}, "
+                       "Error : {MSG}",
+                       "ERRNO", errno, "MSG", strerror(errno));
+            return FD(-1);
+        }
+        written += bytes;
+    }
+
+    // The child reads the stdin from the beginning of the file.
+    if (lseek(stdinFd(), 0, SEEK_SET) < 0 ||
+        posix_spawn_file_actions_adddup2(actions, stdinFd(), STDIN_FILENO) !=
+            0)
+    {
+        lg2::error("Failed to redirect the stdin. Errno : {ERRNO}, "
+                   "Error : {MSG}",
+                   "ERRNO", errno, "MSG", strerror(errno));
+        return FD(-1);
+    }
+    return stdinFd;
+}
+
+std::pair<pid_t, int>
+    AsyncCommandExecutor::spawnCommand(const std::vector<const char*>& argv,
+                                       const auto& actions)
+{
+    if (argv.empty() || argv.front() == nullptr || argv.back() != nullptr)
+    {
+        lg2::error("Invalid arguments to spawn the command");
+        return {-1, EINVAL};
+    }
+
     pid_t pid = -1;
-    int spawnResult = posix_spawn(
-        &pid, "/bin/sh", actions, nullptr,
+    int spawnResult = posix_spawnp(
+        &pid, argv.front(), actions, nullptr,
         // [cppcoreguidelines-pro-type-const-cast,-warnings-as-errors]
         // NOLINTNEXTLINE
-        const_cast<char* const*>(argv), nullptr);
+        const_cast<char* const*>(argv.data()), nullptr);
 
     if (spawnResult != 0)
     {
-        lg2::error("Spawn for executing command failed : {ERROR}", "ERROR",
-                   strerror(spawnResult));
+        lg2::error("Spawn for executing [{CMD}] failed : {ERROR}", "CMD",
+                   argv.front(), "ERROR", strerror(spawnResult));
     }
     return {pid, spawnResult};
 }
 
 sdbusplus::async::task<std::pair<int, std::string>>
     // NOLINTNEXTLINE
-    AsyncCommandExecutor::execCmd(const std::string& cmd)
+    AsyncCommandExecutor::execCmd(const std::vector<const char*>& argv,
+                                  const std::string& stdinData)
 {
     int pipefd[2];
     // Create pipe for the IPC
@@ -128,7 +181,25 @@ sdbusplus::async::task<std::pair<int, std::string>>
         co_return {-1, ""};
     }
 
-    auto [pid, spawnResult] = spawnCommand(cmd, actions);
+    FD stdinFd(-1);
+    if (!stdinData.empty())
+    {
+        stdinFd = setupStdinRedirection(stdinData, actions);
+        if (stdinFd() < 0)
+        {
+            co_return {-1, ""};
+        }
+    }
+
+    auto [pid, spawnResult] = spawnCommand(argv, actions);
+    if (spawnResult != 0)
+    {
+        // There is no child to wait for, Eg: the program is not found.
+        co_return {-1, strerror(spawnResult)};
+    }
+
+    // The child has its own copy of the stdin file descriptor.
+    stdinFd.reset();
 
     // Manually close the write end of the pipe in parent because only the child
     // need to write.
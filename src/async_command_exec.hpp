@@ -9,6 +9,8 @@
 
 #include <sdbusplus/async.hpp>
 
+#include <vector>
+
 namespace data_sync::async
 {
 
@@ -78,18 +80,26 @@ class AsyncCommandExecutor
     AsyncCommandExecutor(sdbusplus::async::context& ctx);
 
     /**
-     * @brief To execute bash commands asynchronously and redirect the
+     * @brief To execute commands asynchronously and redirect the
      *        comamnd output to a pipe to read by parent process using
      *        'posix_spawn'.
      *
-     * @param[in] - cmd - The bash command to execute
+     *        The program is spawned directly without a shell and searched in
+     *        PATH if it is not a path, hence the arguments are not subject to
+     *        the shell expansion or quoting.
+     *
+     * @param[in] - argv - The program and its arguments, terminated by
+     *                     nullptr
+     * @param[in] - stdinData - The data to feed into the stdin of the command,
+     *                          the stdin is not redirected if empty.
      *
      * @return sdbusplus::async::task<std::pair<int, std::string>>
      *              - int : Exit code of the spawned process (-1 on failure)
      *              - std::string : Combined stdout and stderr output
      */
     sdbusplus::async::task<std::pair<int, std::string>>
-        execCmd(const std::string& cmd);
+        execCmd(const std::vector<const char*>& argv,
+                const std::string& stdinData = {});
 
   private:
     /**
@@ -119,19 +129,35 @@ class AsyncCommandExecutor
                               const auto& actions);
 
     /**
-     * @brief API to spawn a child process by wrapping the posix_spawn(),
-     *        executing the provided command string in the spawned child
-     *        process.
+     * @brief API to create an in-memory file with the given data and to
+     *        configure the file actions to use it as the child process stdin.
+     *
+     * The in-memory file is used instead of a pipe so that the parent doesn't
+     * block on writing the data larger than the pipe capacity.
+     *
+     * @param[in]  stdinData  The data to feed into the child stdin.
+     * @param[in]  actions  reference to the posix_spawn file actions object.
+     *
+     * @return The file descriptor of the in-memory file on success;
+     *         otherwise, an invalid file descriptor.
+     */
+    static FD setupStdinRedirection(const std::string& stdinData,
+                                    const auto& actions);
+
+    /**
+     * @brief API to spawn a child process by wrapping the posix_spawnp(),
+     *        executing the provided program in the spawned child process.
      *
-     * @param[in]  cmd     Command string to execute.
+     * @param[in]  argv     The program and its arguments, terminated by
+     *                      nullptr.
      * @param[in]  actions  reference to the posix_spawn file actions object
      *
      * @return std::pair<pid_t, int>
      *         - first  : PID of the spawned child process (-1 for failure).
      *         - second : Result of posix_spawn().
      */
-    std::pair<pid_t, int> spawnCommand(const std::string& cmd,
-                                       const auto& actions);
+    static std::pair<pid_t, int>
+        spawnCommand(const std::vector<const char*>& argv, const auto& actions);
 
     /**
      * @brief API to wait asynchronously until child completes the command
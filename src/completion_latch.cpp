@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "completion_latch.hpp"
+
+#include <sys/eventfd.h>
+
+#include <cerrno>
+#include <system_error>
+
+namespace data_sync::async
+{
+
+CompletionLatch::CompletionLatch(sdbusplus::async::context& ctx) :
+    _ctx(ctx), _eventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (_eventFd() < 0)
+    {
+        throw std::system_error(errno, std::generic_category(),
+                                "Failed to create the completion latch");
+    }
+}
+
+void CompletionLatch::done()
+{
+    if (_count > 0 && --_count == 0)
+    {
+        eventfd_write(_eventFd(), 1);
+    }
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> CompletionLatch::wait()
+{
+    if (_count == 0)
+    {
+        co_return;
+    }
+
+    sdbusplus::async::fdio eventFdio(_ctx, _eventFd());
+    while (_count > 0)
+    {
+        // NOLINTNEXTLINE
+        co_await eventFdio.next();
+    }
+
+    // Clear the signal to reuse the latch.
+    eventfd_t value{0};
+    eventfd_read(_eventFd(), &value);
+    co_return;
+}
+
+} // namespace data_sync::async
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <sdbusplus/async.hpp>
+
+namespace data_sync::async
+{
+
+/**
+ * @class CompletionLatch
+ *
+ * @brief An awaitable counter to join the spawned tasks.
+ *
+ *        - The count is raised for each task spawned and lowered once the
+ *          task completes, and the waiter is woken up via an eventfd only
+ *          when the count drops to zero, so that joining doesn't poll.
+ *        - The latch can be reused once the waiter is woken up.
+ */
+class CompletionLatch
+{
+  public:
+    CompletionLatch(const CompletionLatch&) = delete;
+    CompletionLatch& operator=(const CompletionLatch&) = delete;
+    CompletionLatch(CompletionLatch&&) = delete;
+    CompletionLatch& operator=(CompletionLatch&&) = delete;
+    ~CompletionLatch() = default;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] ctx - The async context object
+     *
+     * @throw std::system_error if the eventfd can't be created.
+     */
+    explicit CompletionLatch(sdbusplus::async::context& ctx);
+
+    /**
+     * @brief API to account a task to wait for.
+     */
+    void add()
+    {
+        ++_count;
+    }
+
+    /**
+     * @brief API to account the completion of a task, the waiter is woken up
+     *        if it is the last task.
+     */
+    void done();
+
+    /**
+     * @brief API to wait until all the accounted tasks complete.
+     */
+    sdbusplus::async::task<> wait();
+
+    /**
+     * @brief Get the number of the tasks which are yet to complete.
+     */
+    size_t getCount() const
+    {
+        return _count;
+    }
+
+  private:
+    /**
+     * @brief The async context object
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The eventfd which is signalled once the count drops to zero
+     */
+    utility::FD _eventFd;
+
+    /**
+     * @brief The number of the tasks which are yet to complete
+     */
+    size_t _count{0};
+};
+
+} // namespace data_sync::async
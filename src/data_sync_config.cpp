@@ -6,6 +6,8 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <regex>
 
 namespace data_sync::config
@@ -24,6 +26,17 @@ bool Retry::operator==(const Retry& retry) const
            _retryIntervalInSec == retry._retryIntervalInSec;
 }
 
+Debounce::Debounce(const std::chrono::milliseconds& settleWindow,
+                   const std::chrono::milliseconds& maxLatency) :
+    _settleWindow(settleWindow), _maxLatency(maxLatency)
+{}
+
+bool Debounce::operator==(const Debounce& debounce) const
+{
+    return _settleWindow == debounce._settleWindow &&
+           _maxLatency == debounce._maxLatency;
+}
+
 NotifySiblingConfig::NotifySiblingConfig(const nlohmann::json& notifySibling)
 {
     if (notifySibling.contains("NotifyOnPaths"))
@@ -69,12 +82,30 @@ DataSyncConfig::DataSyncConfig(const nlohmann::json& config,
         _periodicityInSec =
             convertISODurationToSec(config["Periodicity"].get<std::string>())
                 .value_or(std::chrono::seconds(defPeriodicity));
+
+        if (config.contains("MaxPeriodicity"))
+        {
+            auto maxPeriodicity = convertISODurationToSec(
+                config["MaxPeriodicity"].get<std::string>());
+            if (maxPeriodicity.has_value() &&
+                maxPeriodicity.value() > _periodicityInSec.value())
+            {
+                _maxPeriodicityInSec = maxPeriodicity;
+            }
+        }
     }
     else
     {
         _periodicityInSec = std::nullopt;
     }
 
+    if (config.contains("Criticality"))
+    {
+        _criticality =
+            convertCriticalityToEnum(config["Criticality"].get<std::string>())
+                .value_or(Criticality::Medium);
+    }
+
     if (config.contains("NotifySibling"))
     {
         _notifySibling = NotifySiblingConfig(config["NotifySibling"]);
@@ -93,12 +124,41 @@ DataSyncConfig::DataSyncConfig(const nlohmann::json& config,
                        std::chrono::seconds(DEFAULT_RETRY_INTERVAL));
     }
 
+    if (config.contains("Debounce"))
+    {
+        auto settleWindow =
+            convertISODurationToMs(config["Debounce"].get<std::string>());
+        if (settleWindow.has_value() &&
+            settleWindow.value() > std::chrono::milliseconds::zero())
+        {
+            // Flush at least once in the 10 times of the settle window if
+            // the max latency is not configured.
+            constexpr auto defMaxLatencyFactor = 10;
+            std::optional<std::chrono::milliseconds> maxLatency;
+            if (config.contains("DebounceMaxLatency"))
+            {
+                maxLatency = convertISODurationToMs(
+                    config["DebounceMaxLatency"].get<std::string>());
+            }
+            _debounce = Debounce(
+                settleWindow.value(),
+                std::max(maxLatency.value_or(settleWindow.value() *
+                                             defMaxLatencyFactor),
+                         settleWindow.value()));
+        }
+    }
+    else
+    {
+        _debounce = std::nullopt;
+    }
+
     if (config.contains("ExcludeList"))
     {
         _excludeList.emplace(
             config["ExcludeList"].get<std::unordered_set<fs::path>>(),
-            std::string{});
+            excludeListArgs{});
         frameRsyncExcludeList(_excludeList->first);
+        _excludeMatcher.emplace(_excludeList->first);
     }
     else
     {
@@ -109,11 +169,22 @@ DataSyncConfig::DataSyncConfig(const nlohmann::json& config,
     {
         _includeList =
             config["IncludeList"].get<std::unordered_set<fs::path>>();
+        _includeMatcher.emplace(_includeList.value());
     }
     else
     {
         _includeList = std::nullopt;
     }
+
+    // The include list is synced as the list of paths, hence can't be sharded.
+    if (_isPathDir && !_includeList.has_value() &&
+        config.contains("FullSyncShards"))
+    {
+        if (auto shards = config["FullSyncShards"].get<size_t>(); shards > 1)
+        {
+            _fullSyncShards = shards;
+        }
+    }
 }
 
 bool DataSyncConfig::operator==(const DataSyncConfig& dataSyncCfg) const
@@ -123,24 +194,34 @@ bool DataSyncConfig::operator==(const DataSyncConfig& dataSyncCfg) const
            _destPath == dataSyncCfg._destPath &&
            _syncType == dataSyncCfg._syncType &&
            _periodicityInSec == dataSyncCfg._periodicityInSec &&
+           _maxPeriodicityInSec == dataSyncCfg._maxPeriodicityInSec &&
+           _criticality == dataSyncCfg._criticality &&
            _retry == dataSyncCfg._retry &&
+           _debounce == dataSyncCfg._debounce &&
            _excludeList == dataSyncCfg._excludeList &&
+           _fullSyncShards == dataSyncCfg._fullSyncShards &&
            _includeList == dataSyncCfg._includeList;
 }
 
 void DataSyncConfig::frameRsyncExcludeList(
     const std::unordered_set<fs::path>& excludeList)
 {
+    using namespace std::string_literals;
+
     if (!_excludeList.has_value())
     {
         return;
     }
-    auto foldWithRsyncFilterOpt = [](std::string listToStr,
-                                     const fs::path& entry) {
-        return std::move(listToStr) + " --filter='-/ " + entry.string() + "'";
-    };
-    _excludeList->second = std::ranges::fold_left(excludeList, "",
-                                                  foldWithRsyncFilterOpt);
+
+    // The relative glob patterns are matched at any depth by rsync, the
+    // absolute paths are matched against the absolute path (-/).
+    _excludeList->second.clear();
+    std::ranges::transform(excludeList,
+                           std::back_inserter(_excludeList->second),
+                           [](const fs::path& entry) {
+        return (entry.is_absolute() ? "--filter=-/ "s : "--filter=- "s) +
+               entry.string();
+    });
 }
 
 std::optional<SyncDirection>
@@ -185,6 +266,29 @@ std::optional<SyncType>
     }
 }
 
+std::optional<Criticality>
+    DataSyncConfig::convertCriticalityToEnum(const std::string& criticality)
+{
+    if (criticality == "High")
+    {
+        return Criticality::High;
+    }
+    else if (criticality == "Medium")
+    {
+        return Criticality::Medium;
+    }
+    else if (criticality == "Low")
+    {
+        return Criticality::Low;
+    }
+    else
+    {
+        lg2::error("Unsupported criticality [{CRITICALITY}]", "CRITICALITY",
+                   criticality);
+        return std::nullopt;
+    }
+}
+
 std::optional<std::chrono::seconds> DataSyncConfig::convertISODurationToSec(
     const std::string& timeIntervalInISO)
 {
@@ -210,4 +314,38 @@ std::optional<std::chrono::seconds> DataSyncConfig::convertISODurationToSec(
     }
 }
 
+std::optional<std::chrono::milliseconds>
+    DataSyncConfig::convertISODurationToMs(const std::string& timeIntervalInISO)
+{
+    std::smatch match;
+    std::regex isoDurationRegex(
+        "PT(([0-9]+)H)?(([0-9]+)M)?(([0-9]+)(\\.([0-9]{1,3}))?S)?");
+
+    if (std::regex_search(timeIntervalInISO, match, isoDurationRegex))
+    {
+        // Pad the fractional seconds to milliseconds, Eg: "5" -> "500"
+        constexpr auto msDigits = 3;
+        std::string fraction = match.str(8);
+        fraction.resize(msDigits, '0');
+
+        return std::chrono::hours(match.str(2).empty()
+                                      ? 0
+                                      : std::stoi(match.str(2))) +
+               std::chrono::minutes(match.str(4).empty()
+                                        ? 0
+                                        : std::stoi(match.str(4))) +
+               std::chrono::seconds(match.str(6).empty()
+                                        ? 0
+                                        : std::stoi(match.str(6))) +
+               std::chrono::milliseconds(std::stoi(fraction));
+    }
+    else
+    {
+        lg2::error("{TIME_INTERVAL} is not matching with expected "
+                   "ISO 8601 duration format [PTnHnMn.nS]",
+                   "TIME_INTERVAL", timeIntervalInISO);
+        return std::nullopt;
+    }
+}
+
 } // namespace data_sync::config
@@ -2,14 +2,19 @@
 
 #pragma once
 
+#include "path_matcher.hpp"
+
 #include <nlohmann/json.hpp>
 
 #include <chrono>
 #include <filesystem>
 #include <optional>
+#include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace data_sync::config
 {
@@ -35,6 +40,17 @@ enum class SyncType
     Periodic
 };
 
+/**
+ * @brief The enum contains the criticality tiers in the descending order,
+ *        the configurations of a higher tier are fully synced first.
+ */
+enum class Criticality
+{
+    High,
+    Medium,
+    Low
+};
+
 /**
  * @brief The structure contains all retry-related details
  *        specific to a file or directory to retry if failed to sync.
@@ -71,6 +87,71 @@ struct Retry
     std::chrono::seconds _retryIntervalInSec;
 };
 
+/**
+ * @brief The structure contains the debounce details specific to a file or
+ *        directory to coalesce the changes before syncing.
+ */
+struct Debounce
+{
+    /**
+     * @brief The constructor
+     *
+     * @param[in] settleWindow - The time to wait for no further changes
+     *                           before syncing the modified paths.
+     * @param[in] maxLatency - The maximum time a change can be deferred
+     *                         from the first change, even if the data keeps
+     *                         on changing within the settle window.
+     */
+    Debounce(const std::chrono::milliseconds& settleWindow,
+             const std::chrono::milliseconds& maxLatency);
+
+    /**
+     * @brief Overload the == operator to compare objects.
+     *
+     * @param[in] debounce - The object to check
+     *
+     * @return True if it matches; otherwise, False.
+     */
+    bool operator==(const Debounce& debounce) const;
+
+    /**
+     * @brief The settle window in milliseconds
+     */
+    std::chrono::milliseconds _settleWindow;
+
+    /**
+     * @brief The maximum latency in milliseconds
+     */
+    std::chrono::milliseconds _maxLatency;
+};
+
+/**
+ * @brief The structure holds the paths which are modified within the
+ *        debounce window and yet to be synced.
+ */
+struct PendingSync
+{
+    /**
+     * @brief The deduplicated list of modified paths.
+     */
+    std::set<fs::path> _dirtyPaths;
+
+    /**
+     * @brief The time of the first change since the last flush.
+     */
+    std::chrono::steady_clock::time_point _firstChangeTime;
+
+    /**
+     * @brief The time of the latest change.
+     */
+    std::chrono::steady_clock::time_point _lastChangeTime;
+
+    /**
+     * @brief Indicates whether the flush of the dirty paths is scheduled.
+     */
+    bool _flushScheduled{false};
+};
+
 /**
  * @brief Configuration for notifying the sibling BMC after a successful sync.
  *
@@ -118,12 +199,18 @@ struct DataSyncConfig
     DataSyncConfig(const nlohmann::json& config, bool isPathDir);
 
     /**
-     * @brief API to convert the user configured exclude list to a RSYNC CLI
-     * compatible string with --filter flag.
+     * @brief API to convert the user configured exclude list to the RSYNC
+     * CLI arguments with --filter flag.
      * Eg : If user configured exludeList has 2 paths as /x/y/path1 and
-     *      /x/y/path2, then the rsync cli string will be like below:
+     *      /x/y/path2, then the rsync cli arguments will be like below:
+     *
+     *      {"--filter=-/ /x/y/path1", "--filter=-/ /x/y/path2"}
      *
-     *      " --filter='-/ /x/y/path1' --filter='-/ /x/y/path2'"
+     *      The glob patterns which are not absolute paths are matched at any
+     *      depth, Eg: "*.tmp" will be "--filter=- *.tmp"
+     *
+     *      The arguments are passed to rsync as they are without a shell,
+     *      hence not quoted.
      *
      * @param[in] excludeList - The list of paths to be excluded.
      */
@@ -174,6 +261,25 @@ struct DataSyncConfig
         return "";
     }
 
+    /**
+     * @brief Get criticality in string format.
+     *
+     * @return The criticality in string
+     */
+    constexpr std::string_view getCriticalityInStr() const
+    {
+        switch (_criticality)
+        {
+            case Criticality::High:
+                return "High";
+            case Criticality::Medium:
+                return "Medium";
+            case Criticality::Low:
+                return "Low";
+        }
+        return "";
+    }
+
     /**
      * @brief The file or directory path to be synchronized.
      */
@@ -206,6 +312,20 @@ struct DataSyncConfig
      */
     std::optional<std::chrono::seconds> _periodicityInSec;
 
+    /**
+     * @brief The maximum interval (in seconds) to which the periodic sync
+     *        backs off while the data is not changed.
+     *
+     * @note Holds a value if configured and greater than the periodicity,
+     *       otherwise the periodic sync doesn't back off.
+     */
+    std::optional<std::chrono::seconds> _maxPeriodicityInSec;
+
+    /**
+     * @brief The criticality tier to order the full sync.
+     */
+    Criticality _criticality{Criticality::Medium};
+
     /**
      * @brief The details of sibling notification
      *
@@ -221,19 +341,36 @@ struct DataSyncConfig
      */
     std::optional<Retry> _retry;
 
+    /**
+     * @brief The debounce specific details.
+     *
+     * @note Holds a value if the specific file or directory prefers to
+     *       coalesce the changes within a settle window before syncing.
+     */
+    std::optional<Debounce> _debounce;
+
     /**
      * @brief The list of paths to exclude from synchronization.
      *
      * This optional pair holds:
      *   - A set of filesystem paths to be excluded.
-     *   - A string with rsync `--filter` option derived from the set of paths.
+     *   - The rsync `--filter` arguments derived from the set of paths.
      *
      * @note Holds a value if the specific directory prefer to
      *       exclude some file/directory from synchronization.
      */
     using excludeListSet = std::unordered_set<fs::path>;
-    using excludeListStr = std::string;
-    std::optional<std::pair<excludeListSet, excludeListStr>> _excludeList;
+    using excludeListArgs = std::vector<std::string>;
+    std::optional<std::pair<excludeListSet, excludeListArgs>> _excludeList;
+
+    /**
+     * @brief The number of the shards to split the directory into during the
+     *        full sync, to sync its subdirectories by parallel rsyncs.
+     *
+     * @note Holds a value if the specific directory prefers the sharded full
+     *       sync and doesn't configure the include list.
+     */
+    std::optional<size_t> _fullSyncShards;
 
     /**
      * @brief The list of paths to include from synchronization.
@@ -244,14 +381,38 @@ struct DataSyncConfig
      */
     std::optional<std::unordered_set<fs::path>> _includeList;
 
+    /**
+     * @brief The compiled exclude list to match the modified paths.
+     *
+     * @note Holds a value if the exclude list is configured.
+     */
+    std::optional<PathMatcher> _excludeMatcher;
+
+    /**
+     * @brief The compiled include list to match the modified paths.
+     *
+     * @note Holds a value if the include list is configured.
+     */
+    std::optional<PathMatcher> _includeMatcher;
+
     /**
      * @brief Tracks file or directory paths currently being processed for
      *        sync.
      *
-     *        This container holds paths that are actively undergoing sync. Once
-     *        processing completes, the path is removed from this set.
+     *        This container holds paths that are actively undergoing sync
+     *        along with whether the path is modified again during the sync
+     *        and needs a follow-up sync. Once processing completes, the path
+     *        is removed from this map.
      */
-    mutable std::unordered_set<fs::path> _syncInProgressPaths;
+    mutable std::unordered_map<fs::path, bool> _syncInProgressPaths;
+
+    /**
+     * @brief Tracks the modified paths which are waiting for the debounce
+     *        window to close.
+     *
+     * @note Used only if the debounce is configured.
+     */
+    mutable PendingSync _pendingSync;
 
   private:
     /**
@@ -276,6 +437,17 @@ struct DataSyncConfig
     static std::optional<SyncType>
         convertSyncTypeToEnum(const std::string& syncType);
 
+    /**
+     * @brief A helper API to retrieve the corresponding enum type
+     *        for a given criticality string.
+     *
+     * @param[in] - criticality - the criticality
+     *
+     * @returns The enum value on success; otherwise, nullopt.
+     */
+    static std::optional<Criticality>
+        convertCriticalityToEnum(const std::string& criticality);
+
     /**
      * @brief A helper API to convert the time duration in ISO 8601 duration
      *        format into seconds
@@ -286,6 +458,18 @@ struct DataSyncConfig
      */
     static std::optional<std::chrono::seconds>
         convertISODurationToSec(const std::string& timeIntervalInISO);
+
+    /**
+     * @brief A helper API to convert the time duration in ISO 8601 duration
+     *        format with fractional seconds (Eg: PT0.5S) into milliseconds
+     *
+     * @param[in] - timeIntervalInISO - The time duration
+     *
+     * @returns The time interval in milliseconds on success; otherwise,
+     *          nullopt.
+     */
+    static std::optional<std::chrono::milliseconds>
+        convertISODurationToMs(const std::string& timeIntervalInISO);
 };
 
 } // namespace data_sync::config
@@ -15,45 +15,49 @@ namespace data_sync::watch::inotify
 DataWatcher::DataWatcher(
     sdbusplus::async::context& ctx, const int inotifyFlags,
     const uint32_t eventMasksToWatch, fs::path dataPathToWatch,
-    std::optional<std::unordered_set<fs::path>> excludeList,
-    std::optional<std::unordered_set<fs::path>> includeList) :
-    _inotifyFlags(inotifyFlags), _eventMasksToWatch(eventMasksToWatch),
+    std::optional<config::PathMatcher> excludeMatcher,
+    std::optional<config::PathMatcher> includeMatcher) :
+    _ownedRegistry(std::make_unique<WatchRegistry>(ctx, inotifyFlags)),
+    _registry(*_ownedRegistry), _eventMasksToWatch(eventMasksToWatch),
     _dataPathToWatch(std::move(dataPathToWatch)),
-    _excludeList(std::move(excludeList)), _includeList(std::move(includeList)),
-    _inotifyFileDescriptor(inotifyInit()),
-    _fdioInstance(
-        std::make_unique<sdbusplus::async::fdio>(ctx, _inotifyFileDescriptor()))
+    _excludeMatcher(std::move(excludeMatcher)),
+    _includeMatcher(std::move(includeMatcher))
 {
     createWatchers(_dataPathToWatch);
 }
 
-DataWatcher::~DataWatcher()
+DataWatcher::DataWatcher(
+    WatchRegistry& registry, const uint32_t eventMasksToWatch,
+    fs::path dataPathToWatch,
+    std::optional<config::PathMatcher> excludeMatcher,
+    std::optional<config::PathMatcher> includeMatcher) :
+    _registry(registry), _eventMasksToWatch(eventMasksToWatch),
+    _dataPathToWatch(std::move(dataPathToWatch)),
+    _excludeMatcher(std::move(excludeMatcher)),
+    _includeMatcher(std::move(includeMatcher))
 {
-    if (_inotifyFileDescriptor() >= 0)
+    try
     {
+        createWatchers(_dataPathToWatch);
+    }
+    catch (...)
+    {
+        // The destructor is not invoked if the constructor throws, hence
+        // release the watches added so far from the shared registry.
+        _registry.cancelPendingWatches(this);
         std::ranges::for_each(_watchDescriptors, [this](const auto& wd) {
-            if (wd.first >= 0)
-            {
-                inotify_rm_watch(_inotifyFileDescriptor(), wd.first);
-            }
+            _registry.removeWatch(wd, this);
         });
+        throw;
     }
 }
 
-int DataWatcher::inotifyInit() const
+DataWatcher::~DataWatcher()
 {
-    auto fd = inotify_init1(_inotifyFlags);
-
-    if (-1 == fd)
-    {
-        lg2::error("inotify_init1 call failed with ErrNo : {ERRNO}, ErrMsg : "
-                   "{ERRMSG}",
-                   "ERRNO", errno, "ERRMSG", strerror(errno));
-
-        // TODO: Throw meaningful exception
-        throw std::runtime_error("inotify_init1 failed");
-    }
-    return fd;
+    _registry.cancelPendingWatches(this);
+    std::ranges::for_each(_watchDescriptors, [this](const auto& wd) {
+        _registry.removeWatch(wd, this);
+    });
 }
 
 std::string DataWatcher::eventName(uint32_t eventMask)
@@ -146,52 +150,38 @@ fs::path DataWatcher::getExistingParentPath(const fs::path& dataPath)
 void DataWatcher::addToWatchList(const fs::path& pathToWatch,
                                  uint32_t eventMasksToWatch)
 {
-    auto wd = inotify_add_watch(_inotifyFileDescriptor(), pathToWatch.c_str(),
-                                eventMasksToWatch);
-    if (-1 == wd)
-    {
-        lg2::error(
-            "inotify_add_watch call failed for {PATH} with ErrNo : {ERRNO}, "
-            "ErrMsg : {ERRMSG}",
-            "PATH", pathToWatch, "ERRNO", errno, "ERRMSG", strerror(errno));
-        // TODO: create error log ? bcoz not watching the  path
-        throw std::runtime_error("Failed to add to watch list");
-    }
-    else
-    {
-        // Add trailing slash for directories to ensure rsync syncs directory
-        // contents rather than the directory itself
-        _watchDescriptors.emplace(
-            wd,
-            (fs::is_directory(pathToWatch) ? pathToWatch / "" : pathToWatch));
-        lg2::debug("Watch added. PATH : {PATH}, wd : {WD}", "PATH",
-                   _watchDescriptors[wd], "WD", wd);
-    }
+    auto wd = _registry.addWatch(pathToWatch, eventMasksToWatch, this);
+    _watchDescriptors.emplace(wd);
+    lg2::debug("Watch added. PATH : {PATH}, wd : {WD}", "PATH", pathToWatch,
+               "WD", wd);
 }
 
-bool DataWatcher::isPathExcluded(const fs::path& path)
+std::vector<fs::path> DataWatcher::getWatchingPaths() const
 {
-    auto matchesOrParentOfPath = [&path](const auto& excludePath) {
-        if (fs::is_directory(path))
-        {
-            // If path is directory append '/' and compare whether the given
-            // directory is in exclude list or is a child dir of the configured
-            // exclude path.
-            return (path / "").string().starts_with(excludePath.string());
-        }
-        else
+    std::vector<fs::path> watchingPaths;
+    watchingPaths.reserve(_watchDescriptors.size());
+    for (const auto wd : _watchDescriptors)
+    {
+        // The kernel might have removed the watch along with the path.
+        if (_registry.isWatching(wd))
         {
-            // If path is file, only exact match is valid
-            // Eg : If a file with name 'ID' is in exlcudeList, another file
-            // with name ID1 shouldn't get excluded.
-            return (path.string() == excludePath.string());
+            watchingPaths.emplace_back(_registry.getPath(wd));
         }
-    };
-    if (!_excludeList.has_value())
+    }
+    return watchingPaths;
+}
+
+bool DataWatcher::isPathExcluded(const fs::path& path, bool isDir) const
+{
+    if (!_excludeMatcher.has_value())
     {
         return false;
     }
-    if (std::ranges::any_of(_excludeList.value(), matchesOrParentOfPath))
+
+    // The path is excluded if it matches or is a child of an excluded path
+    // Eg : If a file with name 'ID' is in exlcudeList, another file
+    // with name ID1 shouldn't get excluded.
+    if (_excludeMatcher->matches(path, isDir))
     {
         lg2::debug("{PATH} is in exclude list. Hence skipping", "PATH", path);
         return true;
@@ -199,77 +189,39 @@ bool DataWatcher::isPathExcluded(const fs::path& path)
     return false;
 }
 
-bool DataWatcher::isPathIncluded(const fs::path& path)
+bool DataWatcher::isPathIncluded(const fs::path& path, bool isDir) const
 {
     // A path will be considered as included in the following cases :
     // Case 1. If the given path(file/dir) is present in include list.
     // Case 2. If the given path(file/dir) is child of the path listed in
     // include list.
 
-    if (!_includeList.has_value())
+    if (!_includeMatcher.has_value())
     {
         return false;
     }
 
-    fs::path normalizedPath{};
-    fs::is_directory(path) ? normalizedPath = path / "" : normalizedPath = path;
-
-    if (_includeList.value().contains(normalizedPath))
-    {
-        lg2::debug("{PATH} present inside include list", "PATH",
-                   normalizedPath);
-        return true;
-    }
-
-    // check whether path is child of any includelist path.
-    auto isParentOfNormPath = [&normalizedPath](const auto& includePath) {
-        auto [parentItr, childItr] = std::ranges::mismatch(includePath,
-                                                           normalizedPath);
-        return (parentItr == includePath.end()) || (*parentItr == "");
-    };
-
-    if (auto itr = std::ranges::find_if(_includeList.value(),
-                                        isParentOfNormPath);
-        itr != _includeList.value().end())
+    if (_includeMatcher->matches(path, isDir))
     {
-        lg2::debug("{PATH} is child of the include list path[{INCLUDE}]",
-                   "PATH", normalizedPath, "INCLUDE", *itr);
+        lg2::debug("{PATH} present inside include list", "PATH", path);
         return true;
     }
     return false;
 }
 
-bool DataWatcher::isPathParentOfInclude(const fs::path& path)
+bool DataWatcher::isPathParentOfInclude(const fs::path& path) const
 {
     // If the paths configured in include list is not exists on the
     // filesystem, then it's parent path need to consider as include list and
     // need to monitor until the configured path creates.
-    fs::path normalizedPath{};
-    fs::is_directory(path) ? normalizedPath = path / "" : normalizedPath = path;
-
-    auto childOfPath = [&normalizedPath](const auto& includePath) {
-        // if paths are same return false, as std::mismatch will return the end
-        // iterator for both paths which will cause ambiguity.
-        std::error_code ec;
-        if (fs::equivalent(normalizedPath, includePath, ec))
-        {
-            return false;
-        }
-
-        auto [parentItr, childItr] = std::ranges::mismatch(normalizedPath,
-                                                           includePath);
-        return ((parentItr == normalizedPath.end()) || (*parentItr == ""));
-    };
-
-    if (!_includeList.has_value())
+    if (!_includeMatcher.has_value())
     {
         return false;
     }
-    if (auto itr = std::ranges::find_if(_includeList.value(), childOfPath);
-        itr != _includeList.value().end())
+
+    if (_includeMatcher->isParentOfPattern(path))
     {
-        lg2::debug("{PATH} is parent of the include list path[{INCLUDE}]",
-                   "PATH", path, "INCLUDE", *itr);
+        lg2::debug("{PATH} is parent of the include list path", "PATH", path);
         return true;
     }
     return false;
@@ -285,20 +237,48 @@ void DataWatcher::addSubDirWatches(const fs::path& pathToWatch)
         return;
     }
 
-    auto addWatchIfDir = [this](const fs::path& entry) {
-        if (fs::is_directory(entry))
+    _pendingWalks.emplace_back(pathToWatch);
+    _registry.schedulePendingWatches(this);
+}
+
+size_t DataWatcher::addPendingWatches(size_t maxWatches)
+{
+    // If ExcludeList is configured, exclude those directories and its
+    // subdirectories from monitoring and add watch for rest.
+    auto addWatchIfNotExcluded = [this](const fs::path& dirPath) {
+        if (isPathExcluded(dirPath, true))
         {
-            // If ExcldueList is configured, exclude those directories
-            // from monitoring and add watch for rest.
-            if (_excludeList.has_value() && isPathExcluded(entry))
+            return false;
+        }
+        try
+        {
+            addToWatchList(dirPath, _eventMasksToWatch);
+        }
+        catch (const std::runtime_error&)
+        {
+            // The directory got removed after its parent is read.
+            if (!fs::exists(dirPath))
             {
-                return;
+                return false;
             }
-            addToWatchList(entry, _eventMasksToWatch);
+            throw;
         }
+        return true;
     };
-    std::ranges::for_each(fs::recursive_directory_iterator(pathToWatch),
-                          addWatchIfDir);
+
+    size_t visited{0};
+    while (visited < maxWatches && !_pendingWalks.empty())
+    {
+        visited += _pendingWalks.front().walk(maxWatches - visited,
+                                              addWatchIfNotExcluded);
+        if (_pendingWalks.front().done())
+        {
+            lg2::debug("Added the watches for the subdirectories of {PATH}",
+                       "PATH", _pendingWalks.front().getRootPath());
+            _pendingWalks.pop_front();
+        }
+    }
+    return visited;
 }
 
 void DataWatcher::createWatchers(const fs::path& pathToWatch)
@@ -308,13 +288,13 @@ void DataWatcher::createWatchers(const fs::path& pathToWatch)
     {
         // If IncludeList is configured, then monitor only those and
         // exclude rest.
-        if ((_includeList.has_value()) && (pathToWatch == _dataPathToWatch))
+        if ((_includeMatcher.has_value()) && (pathToWatch == _dataPathToWatch))
         {
             // Either on startup or when _dataPathToWatch (configured
             // path) creates.
             // Hence add watches only for includeList paths instead of iterating
             // through whole directory tree.
-            std::ranges::for_each(_includeList.value(),
+            std::ranges::for_each(_includeMatcher->getPaths(),
                                   [this](const fs::path& includePath) {
                 if (fs::exists(includePath))
                 {
@@ -335,16 +315,17 @@ void DataWatcher::createWatchers(const fs::path& pathToWatch)
             });
             return;
         }
-        else if ((_includeList.has_value()) &&
+        else if ((_includeMatcher.has_value()) &&
                  (pathToWatch.string().starts_with(_dataPathToWatch.string())))
         {
             // Add watches only for included paths if child paths created inside
             // configured paths.
-            if (isPathIncluded(pathToWatch) ||
+            auto isDir = fs::is_directory(pathToWatch);
+            if (isPathIncluded(pathToWatch, isDir) ||
                 isPathParentOfInclude(pathToWatch))
             {
                 addToWatchList(pathToWatch, _eventMasksToWatch);
-                if (fs::is_directory(pathToWatch))
+                if (isDir)
                 {
                     addSubDirWatches(pathToWatch);
                 }
@@ -379,79 +360,23 @@ void DataWatcher::createWatchers(const fs::path& pathToWatch)
 sdbusplus::async::task<DataOperations> DataWatcher::onDataChange()
 {
     // NOLINTNEXTLINE
-    co_await _fdioInstance->next();
-
-    if (auto receivedEvents = readEvents(); receivedEvents.has_value())
-    {
-        processEvents(receivedEvents.value());
-    }
+    co_await _registry.onEvents();
 
-    co_return _dataOperations;
+    co_return takeDataOperations();
 }
 
-std::optional<std::vector<EventInfo>> DataWatcher::readEvents()
+bool DataWatcher::isInterestedEvent(EventMask eventMask) const
 {
-    // Before reading the events clear the map of data operation to remove the
-    // handled operation details.
-    if (!_dataOperations.empty())
+    if (((eventMask & _eventMasksToWatch) != 0) ||
+        ((eventMask & _eventMasksIfNotExists) != 0))
     {
-        _dataOperations.clear();
-    }
-
-    // Maximum inotify events supported in the buffer
-    constexpr auto maxBytes = sizeof(struct inotify_event) + NAME_MAX + 1;
-    uint8_t buffer[maxBytes];
-    std::memset(buffer, '\0', maxBytes);
-
-    auto bytes = read(_inotifyFileDescriptor(), buffer, maxBytes);
-    if (0 > bytes)
-    {
-        // In non blocking mode, read returns immediately with EAGAIN /
-        // EWOULDBLOCK when no data is available, instead of waiting.
-        if (errno != EAGAIN && errno != EWOULDBLOCK)
-        {
-            lg2::error("Failed to read inotify event, error: {ERROR}", "ERROR",
-                       strerror(errno));
-        }
-        return std::nullopt;
+        return true;
     }
 
-    auto offset = 0;
-    std::vector<EventInfo> receivedEvents{};
-    while (offset < bytes)
-    {
-        // NOLINTNEXTLINE to avoid cppcoreguidelines-pro-type-reinterpret-cast
-        auto* receivedEvent = reinterpret_cast<inotify_event*>(&buffer[offset]);
-
-        // Using find() because,
-        // IN_IGNORED events can arrive for already removed watch descriptors
-        // Hence use of [] to access the map entries will cause stale entries.
-        auto wdIter = _watchDescriptors.find(receivedEvent->wd);
-        std::string pathStr = (wdIter != _watchDescriptors.end())
-                                  ? wdIter->second.string()
-                                  : "[removed path]";
-
-        lg2::debug("Received {EVENTS} from {PATH}, wd:{WD} and name : {NAME}",
-                   "EVENTS", eventName(receivedEvent->mask), "PATH", pathStr,
-                   "WD", receivedEvent->wd, "NAME", receivedEvent->name);
-
-        if (((receivedEvent->mask & _eventMasksToWatch) != 0) ||
-            ((receivedEvent->mask & _eventMasksIfNotExists) != 0))
-        {
-            receivedEvents.emplace_back(receivedEvent->wd, receivedEvent->name,
-                                        receivedEvent->mask,
-                                        receivedEvent->cookie);
-        }
-        else
-        {
-            lg2::debug("Skipping the uninterested events[{EVENTS}] for the "
-                       "configured path : {PATH}",
-                       "EVENTS", eventName(receivedEvent->mask), "PATH",
-                       _dataPathToWatch);
-        }
-        offset += offsetof(inotify_event, name) + receivedEvent->len;
-    }
-    return receivedEvents;
+    lg2::debug("Skipping the uninterested events[{EVENTS}] for the "
+               "configured path : {PATH}",
+               "EVENTS", eventName(eventMask), "PATH", _dataPathToWatch);
+    return false;
 }
 
 void DataWatcher::processEvents(
@@ -464,11 +389,35 @@ void DataWatcher::processEvents(
             _dataOperations.emplace_back(dataOperation.value());
         }
     });
+
+    // The paths moved out of the configured path.
+    for (const auto& [cookie, movedFromPath] : _movedFromPaths)
+    {
+        if (!movedFromPath.filename().string().starts_with("."))
+        {
+            lg2::debug("No IN_MOVED_TO received for {PATH} with cookie : "
+                       "{COOKIE}, hence deleting",
+                       "PATH", movedFromPath, "COOKIE", cookie);
+            _dataOperations.emplace_back(movedFromPath, DataOps::DELETE);
+        }
+    }
+    _movedFromPaths.clear();
 }
 
 std::optional<DataOperation>
     DataWatcher::processEvent(const EventInfo& receivedEventInfo)
 {
+    if ((std::get<2>(receivedEventInfo) & IN_Q_OVERFLOW) != 0)
+    {
+        // The pending moves can't be paired anymore and the whole configured
+        // path needs to be synced since the events are lost.
+        lg2::warning("The inotify events are lost for {PATH}, resync is "
+                     "required",
+                     "PATH", _dataPathToWatch);
+        _movedFromPaths.clear();
+        return DataOperation{_dataPathToWatch, DataOps::RESYNC};
+    }
+
     // No current use case for data-sync to support hidden files
     // IN_MOVED_FROM signals for hidden files need to save in order to map
     // with the corresponding IN_MOVED_TO, hence not skipping here.
@@ -482,8 +431,19 @@ std::optional<DataOperation>
         return std::nullopt;
     }
 
+    // The watch might have been removed by an earlier event of the same
+    // batch while the other subscribers still keep it.
+    if (!_watchDescriptors.contains(std::get<WD>(receivedEventInfo)))
+    {
+        lg2::debug("Ignoring the {EVENTS} as the WD : {WD} is no longer "
+                   "watched",
+                   "EVENTS", eventName(std::get<2>(receivedEventInfo)), "WD",
+                   std::get<WD>(receivedEventInfo));
+        return std::nullopt;
+    }
+
     fs::path eventReceivedFor =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo)) /
+        _registry.getPath(std::get<WD>(receivedEventInfo)) /
         std::get<BaseName>(receivedEventInfo);
 
     // Skip the events received for the paths which are in excluded list and not
@@ -494,9 +454,12 @@ std::optional<DataOperation>
     // path doesn't exists, monitoring parent will result is inotify events for
     // the paths which aren't in the tree of include list. No need to process
     // those events.
-    if ((_excludeList.has_value() && isPathExcluded(eventReceivedFor)) ||
-        (_includeList.has_value() &&
-         (!(isPathIncluded(eventReceivedFor)) &&
+    // The IN_ISDIR bit tells whether the event is for a directory, and the
+    // watched path itself has the trailing slash if it is a directory.
+    const bool isDir = (std::get<2>(receivedEventInfo) & IN_ISDIR) != 0;
+    if (isPathExcluded(eventReceivedFor, isDir) ||
+        (_includeMatcher.has_value() &&
+         (!(isPathIncluded(eventReceivedFor, isDir)) &&
           !(isPathParentOfInclude(eventReceivedFor)))))
     {
         lg2::debug("Skipping the {EVENTS} for {PATH} as it is not in the"
@@ -547,7 +510,7 @@ std::optional<DataOperation>
     DataWatcher::processCloseWrite(const EventInfo& receivedEventInfo)
 {
     fs::path eventReceivedFor =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo));
+        _registry.getPath(std::get<WD>(receivedEventInfo));
     lg2::debug("Processing an IN_CLOSE_WRITE for {PATH}", "PATH",
                eventReceivedFor / std::get<BaseName>(receivedEventInfo));
 
@@ -558,11 +521,11 @@ std::optional<DataOperation>
         {
             // Case 1 : The configured file in the JSON was watching and is
             // modified.
-            return std::make_pair(eventReceivedFor, DataOps::COPY);
+            return DataOperation{eventReceivedFor, DataOps::COPY};
         }
-        else if (_includeList.has_value() &&
-                 isPathIncluded(eventReceivedFor /
-                                std::get<BaseName>(receivedEventInfo)))
+        else if (isPathIncluded(eventReceivedFor /
+                                    std::get<BaseName>(receivedEventInfo),
+                                false))
         {
             // Case 2 : Non empty BaseName implies, not watching already.
             // Since the file is in includelist add watch for the same.
@@ -573,9 +536,9 @@ std::optional<DataOperation>
         }
 
         // Case 3 : A file got created or modified inside a watching subdir
-        return std::make_pair(eventReceivedFor /
-                                  std::get<BaseName>(receivedEventInfo),
-                              DataOps::COPY);
+        return DataOperation{eventReceivedFor /
+                                 std::get<BaseName>(receivedEventInfo),
+                             DataOps::COPY};
     }
     else if (fs::equivalent(eventReceivedFor /
                                 std::get<BaseName>(receivedEventInfo),
@@ -586,7 +549,7 @@ std::optional<DataOperation>
         // watcher as it is no longer needed.
         addToWatchList(_dataPathToWatch, _eventMasksToWatch);
         removeWatch(std::get<WD>(receivedEventInfo));
-        return std::make_pair(_dataPathToWatch, DataOps::COPY);
+        return DataOperation{_dataPathToWatch, DataOps::COPY};
     }
 
     return std::nullopt;
@@ -601,7 +564,7 @@ std::optional<DataOperation>
     {
         std::error_code ec;
         fs::path absCreatedPath =
-            _watchDescriptors.at(std::get<WD>(receivedEventInfo)) /
+            _registry.getPath(std::get<WD>(receivedEventInfo)) /
             std::get<BaseName>(receivedEventInfo) / "";
 
         lg2::debug("Processing an IN_CREATE for {PATH}", "PATH",
@@ -616,7 +579,7 @@ std::optional<DataOperation>
             // If include list is configured for the config and with this
             // IN_CREATE, all the paths in include list got created and start
             // watching, then remove the watches for the parent paths.
-            if (_includeList.has_value())
+            if (_includeMatcher.has_value())
             {
                 removeIncludeParentWatches();
             }
@@ -626,11 +589,16 @@ std::optional<DataOperation>
             // Was monitoring existing parent path of the configured data path
             // and a new file/directory got created inside it.
 
-            auto modifyWatchIfExpected = [this, &ec](const fs::path& entry) {
+            auto modifyWatchIfExpected =
+                [this, &ec](const fs::directory_entry& dirEntry) {
+                const auto& entry = dirEntry.path();
+                const bool isDir = dirEntry.is_directory(ec);
+
                 // Before modify watcher, check the created entry is part of
                 // exclude list or include list.
-                if ((_excludeList.has_value() && isPathExcluded(entry)) ||
-                    (_includeList.has_value() && (!(isPathIncluded(entry))) &&
+                if (isPathExcluded(entry, isDir) ||
+                    (_includeMatcher.has_value() &&
+                     (!(isPathIncluded(entry, isDir))) &&
                      (!(isPathParentOfInclude(entry)))))
                 {
                     return false;
@@ -658,17 +626,14 @@ std::optional<DataOperation>
                     // Inotify event received for "a" only and "b" and "c"
                     // created in a single shot. So on recursive directory
                     // iteration, in order to remove the watch for the parents
-                    // 'a' and 'b', need to iterate through the map, as only WD
-                    // of 'a' is known from the inotify event.
-                    if (auto parent =
-                            std::ranges::find_if(_watchDescriptors,
-                                                 [&entry, &ec](const auto& wd) {
-                        return (
-                            fs::equivalent(wd.second, entry.parent_path(), ec));
-                    });
-                        parent != _watchDescriptors.end())
+                    // 'a' and 'b', the WD of the parent is looked up by its
+                    // inode, as only WD of 'a' is known from the inotify event.
+                    if (auto parentWd =
+                            _registry.findWatch(entry.parent_path());
+                        parentWd.has_value() &&
+                        _watchDescriptors.contains(*parentWd))
                     {
-                        removeWatch(parent->first);
+                        removeWatch(*parentWd);
                     }
                     return true;
                 }
@@ -684,7 +649,7 @@ std::optional<DataOperation>
                 return false;
             };
             auto monitoringPath =
-                _watchDescriptors.at(std::get<WD>(receivedEventInfo));
+                _registry.getPath(std::get<WD>(receivedEventInfo));
             std::ranges::for_each(
                 fs::recursive_directory_iterator(monitoringPath),
                 modifyWatchIfExpected);
@@ -693,14 +658,14 @@ std::optional<DataOperation>
         // if includeList is configured, and in non-existing of includeList
         // case, initiate sync only if the created path is matching with
         // configured includeList or is child of the configured includeList.
-        if (_includeList.has_value() && isPathParentOfInclude(absCreatedPath))
+        if (isPathParentOfInclude(absCreatedPath))
         {
             lg2::debug(
                 "{PATH} is parent of include path. Added watch, but skipping sync",
                 "PATH", absCreatedPath);
             return std::nullopt;
         }
-        return std::make_pair(absCreatedPath, DataOps::COPY);
+        return DataOperation{absCreatedPath, DataOps::COPY};
     }
     return std::nullopt;
 }
@@ -713,15 +678,16 @@ std::optional<DataOperation>
     // Case 2 : A file inside a watching directory is renamed.
 
     fs::path absMovedPath =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo)) /
+        _registry.getPath(std::get<WD>(receivedEventInfo)) /
         std::get<BaseName>(receivedEventInfo);
     lg2::debug("Received an IN_MOVED_FROM for {PATH} with  cookie : {COOKIE}",
                "PATH", absMovedPath, "COOKIE", std::get<3>(receivedEventInfo));
     if (absMovedPath.string().starts_with(_dataPathToWatch.string()))
     {
-        _movedFromDataOps.emplace(
-            std::get<3>(receivedEventInfo),
-            std::make_pair(absMovedPath, DataOps::DELETE));
+        // The operation is decided once the IN_MOVED_TO is received or all
+        // the received events are processed.
+        _movedFromPaths.emplace(std::get<3>(receivedEventInfo), absMovedPath);
+        return std::nullopt;
     }
 
     if (std::get<BaseName>(receivedEventInfo).starts_with("."))
@@ -732,7 +698,7 @@ std::optional<DataOperation>
                    std::get<3>(receivedEventInfo));
         return std::nullopt;
     }
-    return std::make_pair(absMovedPath, DataOps::DELETE);
+    return DataOperation{absMovedPath, DataOps::DELETE};
 }
 
 std::optional<DataOperation>
@@ -741,7 +707,7 @@ std::optional<DataOperation>
     // Case 1 : If a file inside a configured and watching directory is renamed.
     // Case 2 : A file is moved to a configured and watching directory.
     fs::path absCopiedPath =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo)) /
+        _registry.getPath(std::get<WD>(receivedEventInfo)) /
         std::get<BaseName>(receivedEventInfo);
 
     if (absCopiedPath.string().starts_with(_dataPathToWatch.string()))
@@ -750,25 +716,37 @@ std::optional<DataOperation>
         lg2::debug("Received an IN_MOVED_TO for {PATH} with  cookie : {COOKIE}",
                    "PATH", absCopiedPath, "COOKIE", cookie);
 
-        if (_movedFromDataOps.contains(cookie))
+        if (auto movedFrom = _movedFromPaths.find(cookie);
+            movedFrom != _movedFromPaths.end())
         {
-            if ((_movedFromDataOps[cookie].first.filename().string())
-                    .starts_with("."))
+            auto movedFromPath = std::move(movedFrom->second);
+            _movedFromPaths.erase(movedFrom);
+
+            if (movedFromPath.filename().string().starts_with("."))
             {
                 lg2::debug("Ignoring the received IN_MOVED_TO for {PATH} with "
                            "cookie : {COOKIE} as update is done by RSYNC",
                            "PATH", absCopiedPath, "COOKIE", cookie);
                 return std::nullopt;
             }
-            else
+
+            lg2::debug("[{OLDPATH}] renamed/moved to [{NEWPATH}]", "OLDPATH",
+                       movedFromPath, "NEWPATH", absCopiedPath);
+
+            // The watches of the moved directory and its sub directories
+            // are kept by the kernel, hence only the path is updated.
+            if ((std::get<2>(receivedEventInfo) & IN_ISDIR) != 0)
             {
-                lg2::debug("[{OLDPATH}] renamed/moved to [{NEWPATH}]",
-                           "OLDPATH", _movedFromDataOps.at(cookie).first,
-                           "NEWPATH", absCopiedPath);
-                _movedFromDataOps.erase(cookie);
+                if (auto wd = _registry.findWatch(absCopiedPath);
+                    wd.has_value() && _watchDescriptors.contains(*wd))
+                {
+                    _registry.moveWatch(*wd, absCopiedPath);
+                }
             }
+            return DataOperation{absCopiedPath, DataOps::MOVE,
+                                 std::move(movedFromPath)};
         }
-        return std::make_pair(absCopiedPath, DataOps::COPY);
+        return DataOperation{absCopiedPath, DataOps::COPY};
     }
     return std::nullopt;
 }
@@ -780,7 +758,7 @@ std::optional<DataOperation>
     // case 2 : A monitoring directory got deleted.
 
     fs::path deletedPath =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo));
+        _registry.getPath(std::get<WD>(receivedEventInfo));
     lg2::debug("Processing IN_DELETE_SELF for {PATH}", "PATH", deletedPath);
 
     // Check if the configured path is same as or a child of the deleted path.
@@ -812,14 +790,14 @@ std::optional<DataOperation>
     // Remove the watch for the deleted path
     removeWatch(std::get<WD>(receivedEventInfo));
 
-    return std::make_pair(deletedPath, DataOps::DELETE);
+    return DataOperation{deletedPath, DataOps::DELETE};
 }
 
 std::optional<DataOperation>
     DataWatcher::processDelete(const EventInfo& receivedEventInfo)
 {
     fs::path deletedPath =
-        _watchDescriptors.at(std::get<WD>(receivedEventInfo)) /
+        _registry.getPath(std::get<WD>(receivedEventInfo)) /
         std::get<BaseName>(receivedEventInfo);
 
     // Deleting sub directories will emit IN_DELETE_SELF as all the
@@ -829,7 +807,7 @@ std::optional<DataOperation>
     {
         // A file inside a monitoring directory got deleted.
         lg2::debug("Processing IN_DELETE for {PATH}", "PATH", deletedPath);
-        return std::make_pair(deletedPath, DataOps::DELETE);
+        return DataOperation{deletedPath, DataOps::DELETE};
     }
 
     return std::nullopt;
@@ -838,26 +816,24 @@ std::optional<DataOperation>
 void DataWatcher::removeIncludeParentWatches()
 {
     auto hasWatches = [this](const auto& incPath) {
-        return std::ranges::any_of(_watchDescriptors,
-                                   [&incPath](const auto& wdPair) {
-            std::error_code ec;
-            return fs::equivalent(wdPair.second, incPath, ec);
-        });
+        auto wd = _registry.findWatch(incPath);
+        return wd.has_value() && _watchDescriptors.contains(*wd);
     };
 
     // Check whether all configured include paths are being watched.
     // If so, remove any parent watches since they are no longer needed.
     // Parent watches will only be added when an include path does not exist
     // at startup.
-    if (_includeList.has_value() &&
-        !std::ranges::all_of(_includeList.value(), hasWatches))
+    if (_includeMatcher.has_value() &&
+        !std::ranges::all_of(_includeMatcher->getPaths(), hasWatches))
     {
         return;
     }
     auto wdItToRemove = _watchDescriptors |
-                        std::views::filter([this](const auto& pair) {
-        return isPathParentOfInclude(pair.second);
-    }) | std::views::transform([](const auto& pair) { return pair.first; });
+                        std::views::filter([this](const WD wd) {
+        return _registry.isWatching(wd) &&
+               isPathParentOfInclude(_registry.getPath(wd));
+    });
 
     std::vector<int> wdToRemove(wdItToRemove.begin(), wdItToRemove.end());
 
@@ -867,13 +843,17 @@ void DataWatcher::removeIncludeParentWatches()
 
 void DataWatcher::removeWatch(int wd)
 {
-    fs::path pathToRemove = _watchDescriptors.at(wd);
-
-    inotify_rm_watch(_inotifyFileDescriptor(), wd);
-    _watchDescriptors.erase(wd);
+    if (_watchDescriptors.erase(wd) == 0)
+    {
+        return;
+    }
 
-    lg2::debug("Stopped monitoring {PATH}, WD : {WD}", "PATH", pathToRemove,
-               "WD", wd);
+    if (_registry.isWatching(wd))
+    {
+        lg2::debug("Stopped monitoring {PATH}, WD : {WD}", "PATH",
+                   _registry.getPath(wd), "WD", wd);
+    }
+    _registry.removeWatch(wd, this);
 }
 
 } // namespace data_sync::watch::inotify
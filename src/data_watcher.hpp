@@ -2,58 +2,31 @@
 
 #pragma once
 
-#include "utility.hpp"
+#include "dir_walker.hpp"
+#include "watch_registry.hpp"
+#include "watcher.hpp"
 
 #include <sys/inotify.h>
 
 #include <data_sync_config.hpp>
 #include <sdbusplus/async.hpp>
 
+#include <deque>
 #include <filesystem>
 #include <map>
-#include <unordered_set>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
 
 namespace data_sync::watch::inotify
 {
 
 namespace fs = std::filesystem;
-namespace utility = data_sync::utility;
 
-/**
- * @brief A tuple which has the info related to the occured inotify event
- *
- * int         - Watch descriptor corresponds to the event
- * std::string - name[] in inotify_event struct
- * uint32_t    - Mask describing event
- */
-using WD = int;
-using BaseName = std::string;
-using EventMask = uint32_t;
-using Cookie = uint32_t;
-using EventInfo = std::tuple<WD, BaseName, EventMask, Cookie>;
-
-/**
- * @brief enum which indicates the type of operations that can take against an
- * intersted inotify event on a configured data path
- */
-enum class DataOps
-{
-    COPY,
-    DELETE
-};
-
-/**
- * @brief Container holding data paths and their corresponding operations.
- *
- * Represents a list of data paths and the type of operation,that needs to be
- * performed on each path.
- *
- * Each entry is a pair of :
- * - fs::path : Absolute path of the file or directory
- * - DataOps  : Operation to perform on the given path
- */
-using DataOperation = std::pair<fs::path, DataOps>;
-using DataOperations = std::vector<DataOperation>;
+using watch::DataOperation;
+using watch::DataOperations;
+using watch::DataOps;
 
 /** @class DataWatcher
  *
@@ -72,59 +45,127 @@ class DataWatcher
      * @brief Constructor
      *
      * Create watcher for directories/files to monitor for the occurence
-     * of the interested events upon modifications.
+     * of the interested events upon modifications using its own inotify
+     * instance.
      *
      *  @param[in] ctx - The async context object
      *  @param[in] inotifyFlags - inotify flags to watch
      *  @param[in] eventMasksToWatch - mask of interested events to watch
      *  @param[in] dataPathToWatch - The absolute path to be monitored using
      *                               inotify
-     *  @param[in] excludeList - The list of paths to be excluded from
-     *                           monitoring
-     *  @param[in] includeList - The list of paths should be included while
-     *                           monitoring
+     *  @param[in] excludeMatcher - The compiled list of paths to be excluded
+     *                              from monitoring
+     *  @param[in] includeMatcher - The compiled list of paths should be
+     *                              included while monitoring
      */
     DataWatcher(
         sdbusplus::async::context& ctx, int inotifyFlags,
         uint32_t eventMasksToWatch, fs::path dataPathToWatch,
-        std::optional<std::unordered_set<fs::path>> excludeList = std::nullopt,
-        std::optional<std::unordered_set<fs::path>> includeList = std::nullopt);
+        std::optional<config::PathMatcher> excludeMatcher = std::nullopt,
+        std::optional<config::PathMatcher> includeMatcher = std::nullopt);
+
+    /**
+     * @brief Constructor
+     *
+     * Create watcher for directories/files to monitor for the occurence
+     * of the interested events upon modifications using the shared inotify
+     * instance of the given registry.
+     *
+     *  @param[in] registry - The registry of the shared inotify watches
+     *  @param[in] eventMasksToWatch - mask of interested events to watch
+     *  @param[in] dataPathToWatch - The absolute path to be monitored using
+     *                               inotify
+     *  @param[in] excludeMatcher - The compiled list of paths to be excluded
+     *                              from monitoring
+     *  @param[in] includeMatcher - The compiled list of paths should be
+     *                              included while monitoring
+     */
+    DataWatcher(
+        WatchRegistry& registry, uint32_t eventMasksToWatch,
+        fs::path dataPathToWatch,
+        std::optional<config::PathMatcher> excludeMatcher = std::nullopt,
+        std::optional<config::PathMatcher> includeMatcher = std::nullopt);
+
     /**
      * @brief Destructor
-     * Remove the inotify watch and close fd's
+     * Remove the inotify watches
      */
     ~DataWatcher();
 
     /**
      * @brief API to monitor for the file/directory for inotify events
      *
-     * @returns bool - true - Inidcates that sync action is required on the
-     *                        received event
-     *                 false - Inidcates that no action is required on the
-     *                         received event
+     * @note Should be used only if the watcher owns the inotify instance,
+     *       the events of the shared registry are consumed by its owner.
+     *
+     * @returns DataOperations - The data operations for the received events
      */
     sdbusplus::async::task<DataOperations> onDataChange();
 
     /**
-     * @brief Get the current watch descriptors map
+     * @brief API to take the data operations accumulated from the events
+     *        dispatched by the registry.
+     *
+     * @returns DataOperations - The data operations since the last call
+     */
+    DataOperations takeDataOperations()
+    {
+        return std::exchange(_dataOperations, {});
+    }
+
+    /**
+     * @brief API to add the next slice of the pending watches of the sub
+     *        directories.
+     *
+     * The registry invokes this while waiting for the events, the owner can
+     * also invoke this to add the pending watches synchronously.
      *
-     * This method provides read-only access to the internal map of watch
-     * descriptors and their associated file paths. Used by Manager to collect
-     * all currently watched paths for debugging purposes.
+     * @param[in] maxWatches - The maximum number of directories to visit
      *
-     * @returns const std::map<WD, fs::path>& - A reference to the map of watch
-     *          descriptors and their associated file paths
+     * @returns The number of visited directories
      */
-    const std::map<WD, fs::path>& getWatchDescriptors() const
+    size_t addPendingWatches(size_t maxWatches);
+
+    /**
+     * @brief API to check whether the watches of any sub directories are
+     *        pending to be added.
+     */
+    bool hasPendingWatches() const
+    {
+        return !_pendingWalks.empty();
+    }
+
+    /**
+     * @brief Get the configured path being monitored
+     */
+    const fs::path& getDataPathToWatch() const
     {
-        return _watchDescriptors;
+        return _dataPathToWatch;
     }
 
+    /**
+     * @brief Get the paths which are currently being watched
+     *
+     * The paths are rebuilt from the registry on each call. Used by Manager
+     * to collect all currently watched paths for debugging purposes.
+     *
+     * @returns std::vector<fs::path> - The list of watched paths
+     */
+    std::vector<fs::path> getWatchingPaths() const;
+
   private:
+    friend class WatchRegistry;
+
     /**
-     * @brief inotify flags
+     * @brief The registry owned by the watcher if it is not sharing the
+     *        inotify instance.
      */
-    int _inotifyFlags;
+    std::unique_ptr<WatchRegistry> _ownedRegistry;
+
+    /**
+     * @brief The registry used to add and remove the inotify watches
+     */
+    WatchRegistry& _registry;
 
     /**
      * @brief The group of interested event Masks for which data to be watched
@@ -148,41 +189,27 @@ class DataWatcher
     const fs::path _dataPathToWatch;
 
     /**
-     * @brief The list of paths to exclude from monitoring.
-     *
-     * This optional pair holds:
-     *   - A set of filesystem paths to be excluded.
-     *   - A string with rsync `--filter` option derived from the set of paths.
+     * @brief The compiled list of paths to exclude from monitoring.
      *
      * @note Holds a value if the specific directory prefer to
      *       exclude some file/directory from synchronization.
      */
-    std::optional<std::unordered_set<fs::path>> _excludeList;
+    std::optional<config::PathMatcher> _excludeMatcher;
 
     /**
-     * @brief The list of paths to include from synchronization.
+     * @brief The compiled list of paths to include from synchronization.
      *
      * @note Holds a value if the specific directory opts to
      *       include only certain file/directory while monitoring
      *       the path.
      */
-    std::optional<std::unordered_set<fs::path>> _includeList;
-
-    /**
-     * @brief The map of unique watch descriptors associated with an configured
-     * file or directory.
-     */
-    std::map<WD, fs::path> _watchDescriptors;
-
-    /**
-     * @brief file descriptor referring to the inotify instance
-     */
-    utility::FD _inotifyFileDescriptor;
+    std::optional<config::PathMatcher> _includeMatcher;
 
     /**
-     * @brief fdio instance
+     * @brief The set of unique watch descriptors associated with an configured
+     * file or directory, the paths are kept by the registry.
      */
-    std::unique_ptr<sdbusplus::async::fdio> _fdioInstance;
+    std::set<WD> _watchDescriptors;
 
     /**
      * @brief Map of DataOperation
@@ -190,17 +217,20 @@ class DataWatcher
     DataOperations _dataOperations;
 
     /**
-     * @brief Map of Cookie and DataOperation to save the inotify event info.
+     * @brief Map of Cookie and the path of the IN_MOVED_FROM events to pair
+     *        with the corresponding IN_MOVED_TO events.
      *
-     * Eg : The IN_MOVED_FROM info during the rename or move operations can be
-     * saved for map to the corresponding IN_MOVED_TO signals.
+     * The kernel queues both the events of a rename together, hence the
+     * paths which are not paired within the received events are moved out
+     * of the configured path and are cleared once the events are processed.
      */
-    std::map<Cookie, DataOperation> _movedFromDataOps;
+    std::map<Cookie, fs::path> _movedFromPaths;
 
     /**
-     * @brief initialize an inotify instance and returns file descriptor
+     * @brief The directories whose sub directories are pending to be
+     *        watched.
      */
-    int inotifyInit() const;
+    std::deque<utility::DirWalker> _pendingWalks;
 
     /**
      * @brief API to convert the inotify event masks to event macros in string
@@ -238,10 +268,11 @@ class DataWatcher
      *        excludeList or the path is child of any of the excluded path.
      *
      * @param[in] path - absolute path of the data
+     * @param[in] isDir - Whether the path is a directory
      * returns : True : If path need to be exlcuded.
      *           False : If path doesn't need to exlcude.
      */
-    bool isPathExcluded(const fs::path& path);
+    bool isPathExcluded(const fs::path& path, bool isDir) const;
 
     /**
      * @brief API to check whether the given path is part of include list
@@ -249,10 +280,11 @@ class DataWatcher
      *        includeList or the path is a child of any of the included path.
      *
      * @param[in] path - absolute path of the data
+     * @param[in] isDir - Whether the path is a directory
      * returns : True : If path need to be inlcuded.
      *           False : If path doesn't need to inlcude.
      */
-    bool isPathIncluded(const fs::path& path);
+    bool isPathIncluded(const fs::path& path, bool isDir) const;
 
     /**
      * @brief Checks whether the given path is a parent of any configured
@@ -265,12 +297,15 @@ class DataWatcher
      * returns : True : If path need to be inlcuded.
      *           False : If path doesn't need to inlcude.
      */
-    bool isPathParentOfInclude(const fs::path& path);
+    bool isPathParentOfInclude(const fs::path& path) const;
 
     /**
      * @brief API to create watchers for the sub directories if the given path
      * is a directory.
      *
+     * The sub directories are walked in slices by the registry, so that a huge
+     * tree doesn't block the async context.
+     *
      * @param[in] pathToWatch - The absolute path of directory.
      */
     void addSubDirWatches(const fs::path& pathToWatch);
@@ -283,16 +318,21 @@ class DataWatcher
     void createWatchers(const std::filesystem::path& pathToWatch);
 
     /**
-     * @brief API to read the triggered events from inotify structure
+     * @brief API to check whether the received inotify event is of interest
+     *        for the watcher.
+     *
+     * @param[in] eventMask - The mask describing event
      *
-     * returns : The vector of events read from the buffer
-     *         : std::nullopt , in case of any errors while reading from buffer
+     * @returns True if interested; otherwise False.
      */
-    std::optional<std::vector<EventInfo>> readEvents();
+    bool isInterestedEvent(EventMask eventMask) const;
 
     /**
      * @brief API to trigger processing of the received inotify events.
      *
+     * The IN_MOVED_FROM events which are not paired with an IN_MOVED_TO
+     * event within the received events are handled as delete.
+     *
      * @param[in] receivedEvents : The vector of type eventInfo type which has
      *                             the information of received inotify events.
      *
@@ -338,6 +378,9 @@ class DataWatcher
     /**
      * @brief API to handle the received IN_MOVED_FROM inotify events
      *
+     * The moved path inside the configured path is saved to pair with the
+     * corresponding IN_MOVED_TO event.
+     *
      * @param[in] receivedEventInfo : eventInfo type which has the information
      *                                of received  inotify event.
      *
@@ -350,6 +393,9 @@ class DataWatcher
     /**
      * @brief API to handle the received IN_MOVED_TO inotify events
      *
+     * Returns MOVE if the event is paired with an IN_MOVED_FROM event,
+     * otherwise COPY.
+     *
      * @param[in] receivedEventInfo : eventInfo type which has the information
      *                                of received  inotify event.
      *
@@ -25,6 +25,8 @@ namespace datasynctool::config_options
 using json = nlohmann::ordered_json;
 
 static constexpr auto watchingPathsFile = "/tmp/data_sync_watching_paths.json";
+static constexpr auto fullSyncEstimateFile =
+    "/tmp/data_sync_full_sync_estimate.json";
 static constexpr auto dataSyncService =
     "xyz.openbmc_project.Control.SyncBMCData.service";
 
@@ -518,4 +520,132 @@ sdbusplus::async::task<> listWatchingPaths(sdbusplus::async::context& ctx,
     co_return;
 }
 
+// Helper: Send SIGUSR2 to daemon and read the resulting full sync estimate
+static sdbusplus::async::task<std::optional<json>>
+    triggerAndReadFullSyncEstimate(sdbusplus::async::context& ctx)
+{
+    // The dry-run of all the configurations may take a while
+    constexpr auto estimateTimeout = std::chrono::minutes(5);
+
+    auto daemonPid =
+        co_await dbus_interactions::getServiceMainPid(ctx, dataSyncService);
+    if (daemonPid == 0)
+    {
+        std::cerr << "Error: phosphor-data-sync daemon is not running\n";
+        co_return std::nullopt;
+    }
+
+    // The daemon replaces the file once the estimate is ready
+    std::error_code ec;
+    const auto lastWriteTime = fs::last_write_time(fullSyncEstimateFile, ec);
+    auto isUpdated = [&lastWriteTime]() {
+        std::error_code ec;
+        auto writeTime = fs::last_write_time(fullSyncEstimateFile, ec);
+        return !ec && writeTime != lastWriteTime;
+    };
+
+    if (kill(daemonPid, SIGUSR2) != 0)
+    {
+        std::cerr
+            << "Error: Failed to send SIGUSR2 to phosphor-data-sync (PID: "
+            << daemonPid << "): " << std::strerror(errno) << "\n";
+        co_return std::nullopt;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + estimateTimeout;
+    while (!isUpdated())
+    {
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            std::cerr << "Error: Timed out waiting for the full sync "
+                         "estimate\n";
+            co_return std::nullopt;
+        }
+        // NOLINTNEXTLINE
+        co_await sdbusplus::async::sleep_for(ctx, std::chrono::seconds(1));
+    }
+
+    std::ifstream file(fullSyncEstimateFile);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Failed to read full sync estimate file: "
+                  << fullSyncEstimateFile << "\n";
+        co_return std::nullopt;
+    }
+
+    try
+    {
+        json data = json::parse(file);
+        if (!data.contains("full_sync_estimate") ||
+            !data["full_sync_estimate"].is_object() || !data.contains("total"))
+        {
+            std::cerr
+                << "Error: Unexpected JSON format in full sync estimate file\n";
+            co_return std::nullopt;
+        }
+        co_return data;
+    }
+    catch (const json::exception& e)
+    {
+        std::cerr << "Error: Failed to parse JSON from " << fullSyncEstimateFile
+                  << ": " << e.what() << "\n";
+        co_return std::nullopt;
+    }
+}
+
+sdbusplus::async::task<> estimateFullSync(sdbusplus::async::context& ctx,
+                                          bool jsonOutput)
+{
+    // NOLINTNEXTLINE
+    auto estimateData = co_await triggerAndReadFullSyncEstimate(ctx);
+    if (!estimateData)
+    {
+        co_return;
+    }
+
+    if (jsonOutput)
+    {
+        std::println("{}", estimateData->dump(4));
+        co_return;
+    }
+
+    constexpr size_t separatorWidth = 60;
+
+    auto printSeparator = [] {
+        std::println("{}", std::string(separatorWidth, '-'));
+    };
+
+    const auto& estimates = (*estimateData)["full_sync_estimate"];
+
+    std::println("Full sync estimate ({} configurations):", estimates.size());
+    printSeparator();
+
+    for (const auto& [configPath, estimate] : estimates.items())
+    {
+        std::println("  {}", configPath);
+        if (!estimate.value("success", false))
+        {
+            std::println("    Failed to estimate (exit code : {})",
+                         estimate.value("exit_code", -1));
+            continue;
+        }
+        std::println("    Files : {}, Bytes : {}",
+                     estimate.value("files", size_t{0}),
+                     estimate.value("bytes", size_t{0}));
+    }
+
+    printSeparator();
+
+    const auto& total = (*estimateData)["total"];
+    std::println("Total files : {}", total.value("files", size_t{0}));
+    std::println("Total bytes : {}", total.value("bytes", size_t{0}));
+
+    if (auto it = estimateData->find("timestamp"); it != estimateData->end())
+    {
+        std::println("Timestamp : {}", it->get<std::string>());
+    }
+
+    co_return;
+}
+
 } // namespace datasynctool::config_options
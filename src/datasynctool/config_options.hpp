@@ -52,4 +52,20 @@ sdbusplus::async::task<> listWatchingPaths(sdbusplus::async::context& ctx,
                                            const std::string& targetPath,
                                            bool jsonOutput);
 
+/**
+ * @brief Estimate the data which a full sync would transfer
+ *
+ * Sends SIGUSR2 signal to the phosphor-data-sync daemon, which triggers
+ * it to dry-run the full sync and dump the estimate to a file. Then waits
+ * for the updated file and displays the per configuration and the total
+ * counts of the files and the bytes.
+ *
+ * @param[in] ctx - Async context
+ * @param[in] jsonOutput - Output in JSON format if true
+ *
+ * @return async task
+ */
+sdbusplus::async::task<> estimateFullSync(sdbusplus::async::context& ctx,
+                                          bool jsonOutput);
+
 } // namespace datasynctool::config_options
@@ -19,6 +19,11 @@ int main(int argc, char* argv[])
     bool fullSync{false};
     fullSyncGroup->add_flag("-f,--fullSync", fullSync, "Start a full sync");
 
+    bool estimateFullSync{false};
+    fullSyncGroup->add_flag(
+        "-n,--estimateFullSync", estimateFullSync,
+        "Estimate the data a full sync would transfer, without syncing");
+
     auto* statusGroup = app.add_option_group(
         "Status Display", "Display current status of phosphor-data-sync");
 
@@ -116,6 +121,12 @@ int main(int argc, char* argv[])
         ctx.spawn(datasynctool::dbus_interactions::startFullSync(ctx));
     }
 
+    if (estimateFullSync)
+    {
+        ctx.spawn(
+            datasynctool::config_options::estimateFullSync(ctx, jsonOutput));
+    }
+
     ctx.spawn(
         sdbusplus::async::execution::just() |
         sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
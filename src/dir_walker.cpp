@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "dir_walker.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace data_sync::utility
+{
+
+DirWalker::DirWalker(fs::path rootPath) : _rootPath(std::move(rootPath)) {}
+
+void DirWalker::openDir(int fd, std::string path)
+{
+    OpenDir dir{FD(fd), std::move(path), {}, 0};
+
+    // The walk is single threaded, hence the buffer is shared.
+    alignas(dirent64) static std::array<char, 32 * 1024> buffer{};
+
+    while (true)
+    {
+        auto bytes = getdents64(dir._fd(), buffer.data(), buffer.size());
+        if (bytes < 0)
+        {
+            lg2::error("Failed to read the directory {PATH}, error: {ERROR}",
+                       "PATH", dir._path, "ERROR", strerror(errno));
+            break;
+        }
+        if (bytes == 0)
+        {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < bytes;)
+        {
+            // NOLINTNEXTLINE to avoid cppcoreguidelines-pro-type-reinterpret-cast
+            const auto* entry = reinterpret_cast<const dirent64*>(
+                &buffer[static_cast<size_t>(offset)]);
+            offset += entry->d_reclen;
+
+            std::string_view name{entry->d_name};
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+
+            auto type = entry->d_type;
+            struct stat entryStat{};
+            if (type == DT_UNKNOWN &&
+                fstatat(dir._fd(), entry->d_name, &entryStat,
+                        AT_SYMLINK_NOFOLLOW) == 0)
+            {
+                type = S_ISDIR(entryStat.st_mode)
+                           ? DT_DIR
+                           : (S_ISLNK(entryStat.st_mode) ? DT_LNK : DT_REG);
+            }
+
+            if (type == DT_DIR)
+            {
+                dir._subDirs.emplace_back(name, true);
+            }
+            else if (type == DT_LNK &&
+                     fstatat(dir._fd(), entry->d_name, &entryStat, 0) == 0 &&
+                     S_ISDIR(entryStat.st_mode))
+            {
+                dir._subDirs.emplace_back(name, false);
+            }
+        }
+    }
+
+    _dirs.emplace_back(std::move(dir));
+}
+
+size_t DirWalker::walk(size_t maxDirs, const Visitor& visitor)
+{
+    if (!_started)
+    {
+        _started = true;
+        auto fd = open(_rootPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            lg2::error("Failed to open the directory {PATH}, error: {ERROR}",
+                       "PATH", _rootPath, "ERROR", strerror(errno));
+            return 0;
+        }
+
+        auto rootPath = _rootPath.string();
+        while (rootPath.size() > 1 && rootPath.back() == '/')
+        {
+            rootPath.pop_back();
+        }
+        openDir(fd, std::move(rootPath));
+    }
+
+    size_t visited{0};
+    while (visited < maxDirs && !_dirs.empty())
+    {
+        auto& dir = _dirs.back();
+        if (dir._next >= dir._subDirs.size())
+        {
+            _dirs.pop_back();
+            continue;
+        }
+
+        auto [name, descend] = dir._subDirs[dir._next++];
+        auto path = dir._path;
+        if (path.back() != '/')
+        {
+            path += '/';
+        }
+        path += name;
+
+        ++visited;
+        if (!visitor(path) || !descend)
+        {
+            continue;
+        }
+
+        // The directory might be removed meanwhile, which is notified to
+        // the watchers of its parent.
+        auto fd = openat(dir._fd(), name.c_str(),
+                         O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        if (fd < 0)
+        {
+            lg2::debug("Failed to open the directory {PATH}, error: {ERROR}",
+                       "PATH", path, "ERROR", strerror(errno));
+            continue;
+        }
+        openDir(fd, std::move(path));
+    }
+    return visited;
+}
+
+} // namespace data_sync::utility
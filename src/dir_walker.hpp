@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace data_sync::utility
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class DirWalker
+ *
+ * @brief Walks the sub directories of a directory tree in bounded slices.
+ *
+ *        - The directories are opened relative to their parent directory
+ *          using openat() and read using getdents64(), hence no path lookup
+ *          and no stat per entry unless the filesystem doesn't report the
+ *          file type.
+ *        - The walk is resumable, so a huge tree can be walked in slices
+ *          without blocking the caller for the whole tree.
+ *        - A symbolic link to a directory is visited but not descended, as
+ *          std::filesystem::recursive_directory_iterator does by default.
+ */
+class DirWalker
+{
+  public:
+    /**
+     * @brief The callback invoked for each sub directory.
+     *
+     * Returns True to descend into the directory; otherwise False.
+     */
+    using Visitor = std::function<bool(const fs::path& dirPath)>;
+
+    /**
+     * @brief Constructor
+     *
+     * The root directory is opened only when the walk starts.
+     *
+     * @param[in] rootPath - The directory to walk
+     */
+    explicit DirWalker(fs::path rootPath);
+
+    /**
+     * @brief API to walk the next slice of the tree.
+     *
+     * @param[in] maxDirs - The maximum number of directories to visit
+     * @param[in] visitor - The callback invoked for each sub directory
+     *
+     * @return The number of visited directories
+     */
+    size_t walk(size_t maxDirs, const Visitor& visitor);
+
+    /**
+     * @brief API to check whether the whole tree is walked.
+     */
+    bool done() const
+    {
+        return _started && _dirs.empty();
+    }
+
+    /**
+     * @brief Get the directory being walked
+     */
+    const fs::path& getRootPath() const
+    {
+        return _rootPath;
+    }
+
+  private:
+    /**
+     * @brief An opened directory whose sub directories are being visited
+     */
+    struct OpenDir
+    {
+        /**
+         * @brief The file descriptor of the directory
+         */
+        FD _fd;
+
+        /**
+         * @brief The path of the directory
+         */
+        std::string _path;
+
+        /**
+         * @brief The names of the sub directories and whether to descend
+         *        into them.
+         */
+        std::vector<std::pair<std::string, bool>> _subDirs;
+
+        /**
+         * @brief The index of the next sub directory to visit
+         */
+        size_t _next{0};
+    };
+
+    /**
+     * @brief API to read the sub directories of the given directory and to
+     *        add it into the list of opened directories.
+     *
+     * @param[in] fd - The file descriptor of the directory
+     * @param[in] path - The path of the directory
+     */
+    void openDir(int fd, std::string path);
+
+    /**
+     * @brief The directory to walk
+     */
+    fs::path _rootPath;
+
+    /**
+     * @brief Indicates the walk is started
+     */
+    bool _started{false};
+
+    /**
+     * @brief The stack of the opened directories from the root directory
+     */
+    std::vector<OpenDir> _dirs;
+};
+
+} // namespace data_sync::utility
@@ -0,0 +1,513 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fanotify_watcher.hpp"
+
+#include <sys/inotify.h>
+#include <sys/statfs.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+namespace data_sync::watch::fanotify
+{
+
+FanotifyWatcher::FanotifyWatcher(sdbusplus::async::context& ctx) :
+    _fanotifyFd(fanotify_init(FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_NONBLOCK |
+                                  FAN_REPORT_DFID_NAME,
+                              O_RDONLY | O_CLOEXEC | O_LARGEFILE)),
+    _eventBuffer(eventBufferSize)
+{
+    if (_fanotifyFd() < 0)
+    {
+        lg2::error("fanotify_init call failed with ErrNo : {ERRNO}, ErrMsg : "
+                   "{ERRMSG}",
+                   "ERRNO", errno, "ERRMSG", strerror(errno));
+        throw std::runtime_error("fanotify_init failed");
+    }
+    _fdioInstance = std::make_unique<sdbusplus::async::fdio>(ctx,
+                                                             _fanotifyFd());
+}
+
+SubscriberId FanotifyWatcher::subscribe(
+    uint32_t eventMasksToWatch, const fs::path& dataPathToWatch,
+    const std::optional<config::PathMatcher>& excludeMatcher,
+    const std::optional<config::PathMatcher>& includeMatcher)
+{
+    auto fsId = addFilesystemMark(dataPathToWatch);
+
+    auto subscriberId = _nextSubscriberId++;
+    _subscribers.emplace(subscriberId,
+                         Subscriber{eventMasksToWatch, dataPathToWatch,
+                                    excludeMatcher, includeMatcher, fsId});
+
+    lg2::debug("Subscribed for {PATH} with id : {ID}", "PATH", dataPathToWatch,
+               "ID", subscriberId);
+    return subscriberId;
+}
+
+void FanotifyWatcher::unsubscribe(SubscriberId subscriberId)
+{
+    auto subscriber = _subscribers.find(subscriberId);
+    if (subscriber == _subscribers.end())
+    {
+        return;
+    }
+
+    auto mark = _filesystemMarks.find(subscriber->second._fsId);
+    if (mark != _filesystemMarks.end() && --mark->second._refCount == 0)
+    {
+        if (fanotify_mark(_fanotifyFd(), FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM,
+                          eventMasksToMark, AT_FDCWD,
+                          mark->second._markedPath.c_str()) != 0)
+        {
+            lg2::error("Failed to remove the fanotify mark for {PATH}, "
+                       "ErrMsg : {ERRMSG}",
+                       "PATH", mark->second._markedPath, "ERRMSG",
+                       strerror(errno));
+        }
+        _filesystemMarks.erase(mark);
+        _dirPathCache.clear();
+    }
+
+    lg2::debug("Unsubscribed the {PATH} with id : {ID}", "PATH",
+               subscriber->second._dataPathToWatch, "ID", subscriberId);
+    _subscribers.erase(subscriber);
+}
+
+std::vector<fs::path>
+    FanotifyWatcher::getWatchingPaths(SubscriberId subscriberId) const
+{
+    if (auto subscriber = _subscribers.find(subscriberId);
+        subscriber != _subscribers.end())
+    {
+        return {subscriber->second._dataPathToWatch};
+    }
+    return {};
+}
+
+FsId FanotifyWatcher::addFilesystemMark(const fs::path& dataPath)
+{
+    // Mark the filesystem using the existing parent path if the configured
+    // path doesn't exist, the filesystem mark reports the events once it
+    // gets created.
+    fs::path pathToMark = dataPath;
+    while (!pathToMark.empty() && !fs::exists(pathToMark))
+    {
+        pathToMark = pathToMark.parent_path();
+    }
+    if (pathToMark.empty())
+    {
+        lg2::error("Parent path not found for the path [{PATH}]", "PATH",
+                   dataPath);
+        throw std::runtime_error("Failed to add the fanotify mark");
+    }
+
+    struct statfs fsStat{};
+    if (statfs(pathToMark.c_str(), &fsStat) != 0)
+    {
+        lg2::error("statfs call failed for {PATH} with ErrMsg : {ERRMSG}",
+                   "PATH", pathToMark, "ERRMSG", strerror(errno));
+        throw std::runtime_error("Failed to add the fanotify mark");
+    }
+
+    FsId fsId{fsStat.f_fsid.__val[0], fsStat.f_fsid.__val[1]};
+    if (auto mark = _filesystemMarks.find(fsId);
+        mark != _filesystemMarks.end())
+    {
+        mark->second._refCount++;
+        return fsId;
+    }
+
+    // The filesystem must support the file handles to report the events
+    // with FAN_REPORT_DFID_NAME, else the mark fails with ENODEV or EXDEV.
+    if (fanotify_mark(_fanotifyFd(), FAN_MARK_ADD | FAN_MARK_FILESYSTEM,
+                      eventMasksToMark, AT_FDCWD, pathToMark.c_str()) != 0)
+    {
+        lg2::error("fanotify_mark call failed for {PATH} with ErrNo : {ERRNO}, "
+                   "ErrMsg : {ERRMSG}",
+                   "PATH", pathToMark, "ERRNO", errno, "ERRMSG",
+                   strerror(errno));
+        throw std::runtime_error("Failed to add the fanotify mark");
+    }
+
+    utility::FD mountFd(open(pathToMark.c_str(), O_RDONLY | O_CLOEXEC));
+    if (mountFd() < 0)
+    {
+        lg2::error("Failed to open {PATH}, ErrMsg : {ERRMSG}", "PATH",
+                   pathToMark, "ERRMSG", strerror(errno));
+        fanotify_mark(_fanotifyFd(), FAN_MARK_REMOVE | FAN_MARK_FILESYSTEM,
+                      eventMasksToMark, AT_FDCWD, pathToMark.c_str());
+        throw std::runtime_error("Failed to add the fanotify mark");
+    }
+
+    lg2::debug("Fanotify mark added for the filesystem of {PATH}", "PATH",
+               pathToMark);
+    _filesystemMarks.emplace(
+        fsId, FilesystemMark{pathToMark, std::move(mountFd), 1});
+    return fsId;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<DataChanges> FanotifyWatcher::onDataChange()
+{
+    // NOLINTNEXTLINE
+    co_await _fdioInstance->next();
+
+    std::map<SubscriberId, DataOperations> dataChanges;
+    readEvents(dataChanges);
+
+    co_return DataChanges(std::make_move_iterator(dataChanges.begin()),
+                          std::make_move_iterator(dataChanges.end()));
+}
+
+void FanotifyWatcher::readEvents(
+    std::map<SubscriberId, DataOperations>& dataChanges)
+{
+    // Drain the whole queue so that a burst of events is returned as one
+    // batch.
+    while (true)
+    {
+        auto bytes = read(_fanotifyFd(), _eventBuffer.data(),
+                          _eventBuffer.size());
+        if (0 > bytes)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                lg2::error("Failed to read fanotify event, error: {ERROR}",
+                           "ERROR", strerror(errno));
+            }
+            break;
+        }
+        if (0 == bytes)
+        {
+            break;
+        }
+        parseEvents(std::span<uint8_t>(_eventBuffer.data(),
+                                       static_cast<size_t>(bytes)),
+                    dataChanges);
+    }
+
+    // The path moved out of the marked filesystems.
+    flushMovedFrom(dataChanges);
+}
+
+void FanotifyWatcher::parseEvents(
+    std::span<uint8_t> buffer,
+    std::map<SubscriberId, DataOperations>& dataChanges)
+{
+    auto len = static_cast<ssize_t>(buffer.size());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* metadata = reinterpret_cast<fanotify_event_metadata*>(buffer.data());
+
+    for (; FAN_EVENT_OK(metadata, len);
+         metadata = FAN_EVENT_NEXT(metadata, len))
+    {
+        if (metadata->vers != FANOTIFY_METADATA_VERSION)
+        {
+            lg2::error("Mismatch of the fanotify metadata version, "
+                       "expected : {EXPECTED}, received : {RECEIVED}",
+                       "EXPECTED", FANOTIFY_METADATA_VERSION, "RECEIVED",
+                       metadata->vers);
+            return;
+        }
+
+        if ((metadata->mask & FAN_Q_OVERFLOW) != 0)
+        {
+            lg2::error("The fanotify event queue overflowed, events are lost");
+            _movedFrom.reset();
+            utility::raiseQueuedEventsLimit(queuedEventsLimitPath);
+
+            // The lost events could be of any subscriber.
+            for (const auto& [subscriberId, subscriber] : _subscribers)
+            {
+                dataChanges[subscriberId].emplace_back(
+                    subscriber._dataPathToWatch, DataOps::RESYNC);
+            }
+            continue;
+        }
+
+        if (metadata->metadata_len + sizeof(fanotify_event_info_fid) >
+            metadata->event_len)
+        {
+            continue;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto* fid = reinterpret_cast<fanotify_event_info_fid*>(
+            reinterpret_cast<uint8_t*>(metadata) + metadata->metadata_len);
+        if (fid->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME)
+        {
+            continue;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto* handle = reinterpret_cast<struct file_handle*>(fid->handle);
+        // The entry name follows the file handle.
+        std::string_view name(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            reinterpret_cast<const char*>(handle->f_handle +
+                                          handle->handle_bytes));
+
+        auto dirPath = resolveDirPath({fid->fsid.val[0], fid->fsid.val[1]},
+                                      handle);
+
+        // The cached paths of the directories under a moved or deleted
+        // directory are stale now.
+        if ((metadata->mask & FAN_ONDIR) != 0 &&
+            (metadata->mask & (FAN_MOVED_FROM | FAN_MOVED_TO | FAN_DELETE)) !=
+                0)
+        {
+            _dirPathCache.clear();
+        }
+
+        if (!dirPath.has_value() || name == ".")
+        {
+            flushMovedFrom(dataChanges);
+            continue;
+        }
+
+        fs::path eventPath = dirPath.value() / name;
+        auto isHidden = name.starts_with(".");
+
+        if ((metadata->mask & FAN_MOVED_TO) != 0 && _movedFrom.has_value())
+        {
+            auto movedFrom = std::exchange(_movedFrom, std::nullopt).value();
+            if (movedFrom._path.filename().string().starts_with("."))
+            {
+                lg2::debug("Ignoring the received FAN_MOVED_TO for {PATH} "
+                           "as update is done by RSYNC",
+                           "PATH", eventPath);
+                continue;
+            }
+
+            if (isHidden)
+            {
+                // Renamed to a hidden path, hence handled as removed.
+                dispatchEvent(movedFrom._path, movedFrom._eventMask,
+                              dataChanges);
+                continue;
+            }
+            dispatchMove(eventPath, metadata->mask, movedFrom, dataChanges);
+            continue;
+        }
+
+        flushMovedFrom(dataChanges);
+
+        if ((metadata->mask & FAN_MOVED_FROM) != 0)
+        {
+            // The operation is decided once the following event is received.
+            _movedFrom = MovedFrom{eventPath, metadata->mask};
+            continue;
+        }
+
+        // No current use case for data-sync to support hidden files
+        if (isHidden)
+        {
+            continue;
+        }
+
+        dispatchEvent(eventPath, metadata->mask, dataChanges);
+    }
+}
+
+std::optional<fs::path>
+    FanotifyWatcher::resolveDirPath(const FsId& fsId,
+                                    struct file_handle* handle)
+{
+    std::string key(std::to_string(fsId.first) + ":" +
+                    std::to_string(fsId.second) + ":" +
+                    std::to_string(handle->handle_type) + ":");
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    key.append(reinterpret_cast<const char*>(handle->f_handle),
+               handle->handle_bytes);
+
+    if (auto dirPath = _dirPathCache.find(key); dirPath != _dirPathCache.end())
+    {
+        return dirPath->second;
+    }
+
+    auto mark = _filesystemMarks.find(fsId);
+    if (mark == _filesystemMarks.end())
+    {
+        return std::nullopt;
+    }
+
+    utility::FD dirFd(open_by_handle_at(mark->second._mountFd(), handle,
+                                        O_PATH | O_CLOEXEC));
+    if (dirFd() < 0)
+    {
+        // The directory is removed already (ESTALE), its removal is reported
+        // separately.
+        lg2::debug("Failed to open the directory handle, ErrMsg : {ERRMSG}",
+                   "ERRMSG", strerror(errno));
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    auto dirPath = fs::read_symlink(
+        fs::path("/proc/self/fd") / std::to_string(dirFd()), ec);
+    if (ec || dirPath.string().ends_with(" (deleted)"))
+    {
+        return std::nullopt;
+    }
+
+    if (_dirPathCache.size() >= maxDirPathCacheSize)
+    {
+        _dirPathCache.clear();
+    }
+    _dirPathCache.emplace(std::move(key), dirPath);
+    return dirPath;
+}
+
+void FanotifyWatcher::dispatchEvent(
+    const fs::path& path, uint64_t eventMask,
+    std::map<SubscriberId, DataOperations>& dataChanges)
+{
+    const bool isDir = (eventMask & FAN_ONDIR) != 0;
+
+    // All the file modifications are handled using FAN_CLOSE_WRITE, hence
+    // only the creation of directories are processed.
+    if ((eventMask & FAN_CREATE) != 0 && !isDir &&
+        (eventMask & (FAN_CLOSE_WRITE | FAN_MOVED_TO)) == 0)
+    {
+        return;
+    }
+
+    // The kernel merges the queued events of the same entry, so the order is
+    // lost if it is both removed and added, hence the current state decides.
+    const bool isRemoved = (eventMask & (FAN_DELETE | FAN_MOVED_FROM)) != 0;
+    const bool isAdded =
+        (eventMask & (FAN_CLOSE_WRITE | FAN_CREATE | FAN_MOVED_TO)) != 0;
+    std::error_code ec;
+    const auto dataOp =
+        (isRemoved && (!isAdded || !fs::exists(fs::symlink_status(path, ec))))
+            ? DataOps::DELETE
+            : DataOps::COPY;
+
+    for (const auto& [subscriberId, subscriber] : _subscribers)
+    {
+        if (!isInterested(subscriber, path, eventMask))
+        {
+            continue;
+        }
+
+        // Add trailing slash for directories to ensure rsync syncs directory
+        // contents rather than the directory itself
+        dataChanges[subscriberId].emplace_back(
+            (isDir && dataOp == DataOps::COPY) ? path / "" : path, dataOp);
+    }
+}
+
+void FanotifyWatcher::dispatchMove(
+    const fs::path& path, uint64_t eventMask, const MovedFrom& movedFrom,
+    std::map<SubscriberId, DataOperations>& dataChanges)
+{
+    const bool isDir = (eventMask & FAN_ONDIR) != 0;
+
+    lg2::debug("[{OLDPATH}] renamed/moved to [{NEWPATH}]", "OLDPATH",
+               movedFrom._path, "NEWPATH", path);
+
+    for (const auto& [subscriberId, subscriber] : _subscribers)
+    {
+        auto isMovedTo = isInterested(subscriber, path, eventMask);
+        auto isMovedFrom = isInterested(subscriber, movedFrom._path,
+                                        movedFrom._eventMask);
+
+        if (isMovedTo && isMovedFrom)
+        {
+            dataChanges[subscriberId].emplace_back(path, DataOps::MOVE,
+                                                   movedFrom._path);
+        }
+        else if (isMovedTo)
+        {
+            dataChanges[subscriberId].emplace_back(isDir ? path / "" : path,
+                                                   DataOps::COPY);
+        }
+        else if (isMovedFrom)
+        {
+            dataChanges[subscriberId].emplace_back(movedFrom._path,
+                                                   DataOps::DELETE);
+        }
+    }
+}
+
+void FanotifyWatcher::flushMovedFrom(
+    std::map<SubscriberId, DataOperations>& dataChanges)
+{
+    auto movedFrom = std::exchange(_movedFrom, std::nullopt);
+    if (!movedFrom.has_value() ||
+        movedFrom->_path.filename().string().starts_with("."))
+    {
+        return;
+    }
+    dispatchEvent(movedFrom->_path, movedFrom->_eventMask, dataChanges);
+}
+
+bool FanotifyWatcher::isInterested(const Subscriber& subscriber,
+                                   const fs::path& path, uint64_t eventMask)
+{
+    if (!utility::isSameOrChildPath(subscriber._dataPathToWatch, path))
+    {
+        return false;
+    }
+
+    // Compare against the subscribed inotify masks.
+    uint32_t inotifyMask = 0;
+    if ((eventMask & FAN_CLOSE_WRITE) != 0)
+    {
+        inotifyMask |= IN_CLOSE_WRITE;
+    }
+    if ((eventMask & FAN_CREATE) != 0)
+    {
+        inotifyMask |= IN_CREATE;
+    }
+    if ((eventMask & FAN_DELETE) != 0)
+    {
+        inotifyMask |= IN_DELETE;
+
+        // The removal of the configured path is reported in its parent
+        // directory, which is IN_DELETE_SELF in inotify.
+        if (utility::isSameOrChildPath(path, subscriber._dataPathToWatch))
+        {
+            inotifyMask |= IN_DELETE_SELF;
+        }
+    }
+    if ((eventMask & FAN_MOVED_FROM) != 0)
+    {
+        inotifyMask |= IN_MOVED_FROM;
+    }
+    if ((eventMask & FAN_MOVED_TO) != 0)
+    {
+        inotifyMask |= IN_MOVED_TO;
+    }
+    if ((subscriber._eventMasksToWatch & inotifyMask) == 0)
+    {
+        return false;
+    }
+
+    const bool isDir = (eventMask & FAN_ONDIR) != 0;
+    if (subscriber._excludeMatcher.has_value() &&
+        subscriber._excludeMatcher->matches(path, isDir))
+    {
+        lg2::debug("{PATH} is in exclude list. Hence skipping", "PATH", path);
+        return false;
+    }
+
+    if (subscriber._includeMatcher.has_value() &&
+        !subscriber._includeMatcher->matches(path, isDir))
+    {
+        return false;
+    }
+    return true;
+}
+
+} // namespace data_sync::watch::fanotify
@@ -0,0 +1,305 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+#include "watcher.hpp"
+
+#include <fcntl.h>
+#include <sys/fanotify.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <filesystem>
+#include <map>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace data_sync::watch::fanotify
+{
+
+namespace fs = std::filesystem;
+namespace utility = data_sync::utility;
+
+/**
+ * @brief The filesystem id reported in the fanotify events and by statfs()
+ */
+using FsId = std::pair<int, int>;
+
+/**
+ * @class FanotifyWatcher
+ *
+ * @brief The watcher backend which monitors the configured paths using
+ *        fanotify filesystem marks.
+ *
+ *        - A single mark is placed per filesystem instead of a watch per
+ *          directory, so the startup cost and the kernel memory don't depend
+ *          on the size of the monitored trees and the newly created
+ *          subdirectories are monitored without any race.
+ *        - The events are reported with the parent directory file handle and
+ *          the entry name (FAN_REPORT_DFID_NAME) and filtered in userspace
+ *          against the configured paths of the subscribers.
+ *
+ * @note Requires CAP_SYS_ADMIN and a kernel with FAN_REPORT_DFID_NAME support
+ *       (5.9+), and the monitored filesystem must support file handles.
+ */
+class FanotifyWatcher : public WatcherBackend
+{
+  public:
+    FanotifyWatcher(const FanotifyWatcher&) = delete;
+    FanotifyWatcher& operator=(const FanotifyWatcher&) = delete;
+    FanotifyWatcher(FanotifyWatcher&&) = delete;
+    FanotifyWatcher& operator=(FanotifyWatcher&&) = delete;
+    ~FanotifyWatcher() override = default;
+
+    /**
+     * @brief Constructor
+     *
+     * Initializes the fanotify group.
+     *
+     * @param[in] ctx - The async context object
+     *
+     * @note Throws std::runtime_error if fanotify is not supported.
+     */
+    explicit FanotifyWatcher(sdbusplus::async::context& ctx);
+
+    SubscriberId subscribe(
+        uint32_t eventMasksToWatch, const fs::path& dataPathToWatch,
+        const std::optional<config::PathMatcher>& excludeMatcher,
+        const std::optional<config::PathMatcher>& includeMatcher) override;
+
+    void unsubscribe(SubscriberId subscriberId) override;
+
+    sdbusplus::async::task<DataChanges> onDataChange() override;
+
+    std::vector<fs::path>
+        getWatchingPaths(SubscriberId subscriberId) const override;
+
+  private:
+    /**
+     * @brief The details of a subscriber
+     */
+    struct Subscriber
+    {
+        /**
+         * @brief The group of interested inotify event masks
+         */
+        uint32_t _eventMasksToWatch;
+
+        /**
+         * @brief The file or directory path to be monitored.
+         */
+        fs::path _dataPathToWatch;
+
+        /**
+         * @brief The compiled list of paths to exclude from monitoring.
+         */
+        std::optional<config::PathMatcher> _excludeMatcher;
+
+        /**
+         * @brief The compiled list of paths to include while monitoring.
+         */
+        std::optional<config::PathMatcher> _includeMatcher;
+
+        /**
+         * @brief The id of the filesystem marked for the subscriber.
+         */
+        FsId _fsId;
+    };
+
+    /**
+     * @brief The details of a marked filesystem
+     */
+    struct FilesystemMark
+    {
+        /**
+         * @brief The path used to mark the filesystem
+         */
+        fs::path _markedPath;
+
+        /**
+         * @brief The file descriptor of the marked path, used to open the
+         *        file handles reported in the events.
+         */
+        utility::FD _mountFd;
+
+        /**
+         * @brief The number of subscribers using the mark.
+         */
+        size_t _refCount{0};
+    };
+
+    /**
+     * @brief The details of a FAN_MOVED_FROM event waiting to be paired
+     */
+    struct MovedFrom
+    {
+        /**
+         * @brief The absolute path the entry is moved from
+         */
+        fs::path _path;
+
+        /**
+         * @brief The fanotify event mask
+         */
+        uint64_t _eventMask;
+    };
+
+    /**
+     * @brief The fanotify events of interest
+     */
+    static constexpr uint64_t eventMasksToMark =
+        FAN_CLOSE_WRITE | FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM |
+        FAN_MOVED_TO | FAN_ONDIR;
+
+    /**
+     * @brief The size of the buffer used to read the fanotify events.
+     */
+    static constexpr size_t eventBufferSize = 16 * 1024;
+
+    /**
+     * @brief Maximum number of directory paths to cache.
+     */
+    static constexpr size_t maxDirPathCacheSize = 4096;
+
+    /**
+     * @brief The sysctl file of the queued events limit of fanotify groups
+     */
+    static constexpr auto queuedEventsLimitPath =
+        "/proc/sys/fs/fanotify/max_queued_events";
+
+    /**
+     * @brief API to place the filesystem mark for the given path if not
+     *        marked already.
+     *
+     * @param[in] dataPath - The path to be monitored
+     *
+     * @return The id of the marked filesystem
+     *
+     * @note Throws std::runtime_error on failure.
+     */
+    FsId addFilesystemMark(const fs::path& dataPath);
+
+    /**
+     * @brief API to read and parse all the queued fanotify events.
+     *
+     * @param[out] dataChanges - The data operations per subscriber
+     */
+    void readEvents(std::map<SubscriberId, DataOperations>& dataChanges);
+
+    /**
+     * @brief API to parse the fanotify events from the given buffer.
+     *
+     * @param[in] buffer - The buffer which has the fanotify events.
+     * @param[out] dataChanges - The data operations per subscriber
+     */
+    void parseEvents(std::span<uint8_t> buffer,
+                     std::map<SubscriberId, DataOperations>& dataChanges);
+
+    /**
+     * @brief API to resolve the directory path of the reported file handle.
+     *
+     * @param[in] fsId - The filesystem id of the file handle
+     * @param[in] handle - The reported file handle
+     *
+     * @return The directory path on success; otherwise, nullopt.
+     */
+    std::optional<fs::path> resolveDirPath(const FsId& fsId,
+                                           struct file_handle* handle);
+
+    /**
+     * @brief API to convert the received event into data operations for the
+     *        interested subscribers.
+     *
+     * @param[in] path - The absolute path of the event
+     * @param[in] eventMask - The fanotify event mask
+     * @param[out] dataChanges - The data operations per subscriber
+     */
+    void dispatchEvent(const fs::path& path, uint64_t eventMask,
+                       std::map<SubscriberId, DataOperations>& dataChanges);
+
+    /**
+     * @brief API to convert the paired FAN_MOVED_FROM and FAN_MOVED_TO events
+     *        into data operations for the interested subscribers.
+     *
+     * A subscriber interested in both the paths gets a MOVE, else a DELETE
+     * or a COPY same as the inotify backend.
+     *
+     * @param[in] path - The absolute path the entry is moved to
+     * @param[in] eventMask - The fanotify event mask of FAN_MOVED_TO
+     * @param[in] movedFrom - The paired FAN_MOVED_FROM event
+     * @param[out] dataChanges - The data operations per subscriber
+     */
+    void dispatchMove(const fs::path& path, uint64_t eventMask,
+                      const MovedFrom& movedFrom,
+                      std::map<SubscriberId, DataOperations>& dataChanges);
+
+    /**
+     * @brief API to dispatch the FAN_MOVED_FROM event which is not paired
+     *        with a FAN_MOVED_TO, i.e. moved out of the marked filesystems.
+     *
+     * @param[out] dataChanges - The data operations per subscriber
+     */
+    void flushMovedFrom(std::map<SubscriberId, DataOperations>& dataChanges);
+
+    /**
+     * @brief API to check whether the subscriber is interested in the event
+     *        for the given path.
+     *
+     * @param[in] subscriber - The subscriber to check
+     * @param[in] path - The absolute path of the event
+     * @param[in] eventMask - The fanotify event mask
+     *
+     * @return True if interested; otherwise False.
+     */
+    static bool isInterested(const Subscriber& subscriber, const fs::path& path,
+                             uint64_t eventMask);
+
+    /**
+     * @brief The fanotify group file descriptor
+     */
+    utility::FD _fanotifyFd;
+
+    /**
+     * @brief fdio instance
+     */
+    std::unique_ptr<sdbusplus::async::fdio> _fdioInstance;
+
+    /**
+     * @brief Reusable buffer to read the fanotify events.
+     */
+    std::vector<uint8_t> _eventBuffer;
+
+    /**
+     * @brief The id of the next subscriber.
+     */
+    SubscriberId _nextSubscriberId{0};
+
+    /**
+     * @brief The map of subscribers
+     */
+    std::map<SubscriberId, Subscriber> _subscribers;
+
+    /**
+     * @brief The map of marked filesystems
+     */
+    std::map<FsId, FilesystemMark> _filesystemMarks;
+
+    /**
+     * @brief The cache of the resolved directory paths keyed by the file
+     *        handle, to avoid resolving for every event.
+     */
+    std::unordered_map<std::string, fs::path> _dirPathCache;
+
+    /**
+     * @brief The last FAN_MOVED_FROM event to pair it with the following
+     *        FAN_MOVED_TO event of the same rename.
+     *
+     * @note fanotify doesn't report the rename cookie, but the kernel queues
+     *       both the events of a rename one after the other.
+     */
+    std::optional<MovedFrom> _movedFrom;
+};
+
+} // namespace data_sync::watch::fanotify
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "full_sync_checkpoint.hpp"
+
+#include "persistent.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <format>
+
+namespace data_sync::persist
+{
+
+fs::path FullSyncCheckpointFile =
+    "/var/lib/phosphor-data-sync/persistence/full_sync_checkpoint.json";
+
+namespace
+{
+constexpr auto generationKey = "Generation";
+constexpr auto completedKey = "Completed";
+} // namespace
+
+FullSyncCheckpoint::FullSyncCheckpoint(fs::path checkpointFile) :
+    _checkpointFile(std::move(checkpointFile))
+{}
+
+size_t FullSyncCheckpoint::load(uint64_t generation)
+{
+    _generation = generation;
+    _completed.clear();
+
+    try
+    {
+        auto json = readFile(_checkpointFile);
+        if (json.has_value() && json->value(generationKey, uint64_t{0}) ==
+                                    generation)
+        {
+            _completed = json->value(completedKey, std::set<std::string>{});
+        }
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to load the full sync checkpoint [{FILE}]: {ERROR}",
+                   "FILE", _checkpointFile, "ERROR", e);
+        _completed.clear();
+    }
+
+    if (_completed.empty())
+    {
+        // Drop the checkpoint of a different generation.
+        clear();
+    }
+    return _completed.size();
+}
+
+void FullSyncCheckpoint::markCompleted(const std::string& key)
+{
+    if (_completed.emplace(key).second)
+    {
+        save();
+    }
+}
+
+void FullSyncCheckpoint::clear()
+{
+    _completed.clear();
+    std::error_code ec;
+    fs::remove(_checkpointFile, ec);
+}
+
+std::string FullSyncCheckpoint::getShardKey(const fs::path& cfgPath,
+                                            size_t shard, size_t shardCount)
+{
+    return std::format("{}#{}/{}", cfgPath.string(), shard, shardCount);
+}
+
+void FullSyncCheckpoint::save() const
+{
+    nlohmann::json json{{generationKey, _generation},
+                        {completedKey, _completed}};
+
+    // Replace the checkpoint atomically so that an interruption while
+    // writing doesn't lose the completed entries.
+    auto tmpFile = _checkpointFile;
+    tmpFile += ".tmp";
+    try
+    {
+        util::writeFile(json, tmpFile);
+        fs::rename(tmpFile, _checkpointFile);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to save the full sync checkpoint [{FILE}]: {ERROR}",
+                   "FILE", _checkpointFile, "ERROR", e);
+    }
+}
+
+} // namespace data_sync::persist
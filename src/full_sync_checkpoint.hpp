@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <set>
+#include <string>
+
+namespace data_sync::persist
+{
+
+namespace fs = std::filesystem;
+
+extern fs::path FullSyncCheckpointFile;
+
+/**
+ * @class FullSyncCheckpoint
+ *
+ * @brief The progress of an interrupted full sync, so that the next full
+ *        sync resumes only the configurations, and the shards of a sharded
+ *        configuration, which are not yet completed.
+ *
+ *        - The checkpoint is valid only for the same generation, that is the
+ *          identifier of the data sync configuration and the BMC role, so
+ *          a configuration change or a failover starts the full sync from
+ *          scratch.
+ *        - The checkpoint is rewritten atomically on each completion and
+ *          removed once the full sync completes.
+ */
+class FullSyncCheckpoint
+{
+  public:
+    /**
+     * @brief Constructor
+     *
+     * The checkpoint file is read only on load().
+     *
+     * @param[in] checkpointFile - The path of the checkpoint file
+     */
+    explicit FullSyncCheckpoint(
+        fs::path checkpointFile = FullSyncCheckpointFile);
+
+    /**
+     * @brief API to load the checkpoint of the previous full sync.
+     *
+     * @param[in] generation - The generation of the full sync, the completed
+     *                         entries of a different generation are dropped.
+     *
+     * @return The number of the completed entries which are resumed
+     */
+    size_t load(uint64_t generation);
+
+    /**
+     * @brief API to check whether the given entry is already completed.
+     *
+     * @param[in] key - The configured path, or the shard of it
+     */
+    bool isCompleted(const std::string& key) const
+    {
+        return _completed.contains(key);
+    }
+
+    /**
+     * @brief API to mark the given entry as completed and to persist it.
+     *
+     * @param[in] key - The configured path, or the shard of it
+     */
+    void markCompleted(const std::string& key);
+
+    /**
+     * @brief API to remove the checkpoint once the full sync completes.
+     */
+    void clear();
+
+    /**
+     * @brief Get the key of the shard of a sharded configuration
+     *
+     * @param[in] cfgPath - The configured path
+     * @param[in] shard - The shard index, or the shard count for the top
+     *                    level of the configured path
+     * @param[in] shardCount - The number of the shards
+     */
+    static std::string getShardKey(const fs::path& cfgPath, size_t shard,
+                                   size_t shardCount);
+
+  private:
+    /**
+     * @brief API to write the checkpoint into the file atomically.
+     */
+    void save() const;
+
+    /**
+     * @brief The path of the checkpoint file
+     */
+    fs::path _checkpointFile;
+
+    /**
+     * @brief The generation of the full sync
+     */
+    uint64_t _generation{0};
+
+    /**
+     * @brief The completed entries
+     */
+    std::set<std::string> _completed;
+};
+
+} // namespace data_sync::persist
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "inotify_watcher.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+namespace data_sync::watch::inotify
+{
+
+InotifyWatcher::InotifyWatcher(sdbusplus::async::context& ctx) :
+    _registry(ctx, IN_NONBLOCK | IN_CLOEXEC)
+{}
+
+SubscriberId InotifyWatcher::subscribe(
+    uint32_t eventMasksToWatch, const fs::path& dataPathToWatch,
+    const std::optional<config::PathMatcher>& excludeMatcher,
+    const std::optional<config::PathMatcher>& includeMatcher)
+{
+    auto dataWatcher = std::make_unique<DataWatcher>(
+        _registry, eventMasksToWatch, dataPathToWatch, excludeMatcher,
+        includeMatcher);
+
+    auto subscriberId = _nextSubscriberId++;
+    _dataWatchers.emplace(subscriberId, std::move(dataWatcher));
+
+    lg2::debug("Subscribed for {PATH} with id : {ID}, total watches : {COUNT}",
+               "PATH", dataPathToWatch, "ID", subscriberId, "COUNT",
+               _registry.watchCount());
+    return subscriberId;
+}
+
+void InotifyWatcher::unsubscribe(SubscriberId subscriberId)
+{
+    _dataWatchers.erase(subscriberId);
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<DataChanges> InotifyWatcher::onDataChange()
+{
+    // NOLINTNEXTLINE
+    co_await _registry.onEvents();
+
+    DataChanges dataChanges;
+    for (const auto& [subscriberId, dataWatcher] : _dataWatchers)
+    {
+        if (auto dataOperations = dataWatcher->takeDataOperations();
+            !dataOperations.empty())
+        {
+            dataChanges.emplace_back(subscriberId, std::move(dataOperations));
+        }
+    }
+    co_return dataChanges;
+}
+
+std::vector<fs::path>
+    InotifyWatcher::getWatchingPaths(SubscriberId subscriberId) const
+{
+    if (auto dataWatcher = _dataWatchers.find(subscriberId);
+        dataWatcher != _dataWatchers.end())
+    {
+        return dataWatcher->second->getWatchingPaths();
+    }
+    return {};
+}
+
+} // namespace data_sync::watch::inotify
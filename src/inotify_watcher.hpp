@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "data_watcher.hpp"
+#include "watch_registry.hpp"
+#include "watcher.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+
+namespace data_sync::watch::inotify
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class InotifyWatcher
+ *
+ * @brief The watcher backend which monitors the configured paths using a
+ *        single inotify instance shared by the DataWatcher of each
+ *        subscriber.
+ *
+ *        - The number of watches placed in the kernel and the reactor
+ *          wakeups scale with the unique directories being monitored, not
+ *          with the number of configured paths.
+ */
+class InotifyWatcher : public WatcherBackend
+{
+  public:
+    InotifyWatcher(const InotifyWatcher&) = delete;
+    InotifyWatcher& operator=(const InotifyWatcher&) = delete;
+    InotifyWatcher(InotifyWatcher&&) = delete;
+    InotifyWatcher& operator=(InotifyWatcher&&) = delete;
+    ~InotifyWatcher() override = default;
+
+    /**
+     * @brief Constructor
+     *
+     * Initializes the shared inotify instance.
+     *
+     * @param[in] ctx - The async context object
+     */
+    explicit InotifyWatcher(sdbusplus::async::context& ctx);
+
+    SubscriberId subscribe(
+        uint32_t eventMasksToWatch, const fs::path& dataPathToWatch,
+        const std::optional<config::PathMatcher>& excludeMatcher,
+        const std::optional<config::PathMatcher>& includeMatcher) override;
+
+    void unsubscribe(SubscriberId subscriberId) override;
+
+    sdbusplus::async::task<DataChanges> onDataChange() override;
+
+    std::vector<fs::path>
+        getWatchingPaths(SubscriberId subscriberId) const override;
+
+  private:
+    /**
+     * @brief The registry of the shared inotify watches
+     */
+    WatchRegistry _registry;
+
+    /**
+     * @brief The id of the next subscriber.
+     */
+    SubscriberId _nextSubscriberId{0};
+
+    /**
+     * @brief The map of subscribers and their DataWatcher instances
+     *
+     * @note Declared after the registry so that the watches are released
+     *       before the registry is destroyed.
+     */
+    std::map<SubscriberId, std::unique_ptr<DataWatcher>> _dataWatchers;
+};
+
+} // namespace data_sync::watch::inotify
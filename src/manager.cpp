@@ -5,7 +5,10 @@
 #include "manager.hpp"
 
 #include "async_command_exec.hpp"
+#include "completion_latch.hpp"
 #include "data_watcher.hpp"
+#include "fanotify_watcher.hpp"
+#include "inotify_watcher.hpp"
 #include "notify_sibling.hpp"
 #include "utility.hpp"
 
@@ -16,16 +19,22 @@
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/async/context.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <csignal>
 #include <cstring>
 #include <exception>
 #include <experimental/scope>
+#include <format>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
+#include <limits>
+#include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace data_sync
 {
@@ -34,7 +43,8 @@ Manager::Manager(sdbusplus::async::context& ctx,
                  std::unique_ptr<ext_data::ExternalDataIFaces>&& extDataIfaces,
                  const fs::path& dataSyncCfgDir) :
     _ctx(ctx), _extDataIfaces(std::move(extDataIfaces)),
-    _dataSyncCfgDir(dataSyncCfgDir), _syncBMCDataIface(ctx, *this)
+    _dataSyncCfgDir(dataSyncCfgDir), _syncBMCDataIface(ctx, *this),
+    _syncScheduler(ctx, MAX_CONCURRENT_SYNCS), _retryQueue(ctx)
 {
 // Skip SIGUSR1 registration in unit tests to avoid waiting
 // indefinitely for a signal and time out issues.
@@ -42,6 +52,7 @@ Manager::Manager(sdbusplus::async::context& ctx,
     // Register SIGUSR1 handler
     registerSignalHandler();
 #endif
+    createWatcherBackend();
     _ctx.spawn(init());
 }
 
@@ -68,8 +79,29 @@ sdbusplus::async::task<> Manager::init()
      * role changes, ensuring data is synchronized according to the new role.
      */
     _ctx.spawn(_extDataIfaces->watchRedundancyMgrProps());
+
+    // The syncs are parked while the sibling BMC is not reachable, the
+    // sibling is probed via the local stunnel client port which forwards
+    // to its rsync daemon.
+    using namespace std::chrono_literals;
+    const auto siblingPort = static_cast<uint16_t>(std::stoul(
+        _extDataIfaces->bmcPosition() == 0 ? BMC1_RSYNC_PORT
+                                           : BMC0_RSYNC_PORT));
+    _siblingMonitor = std::make_unique<async::SiblingMonitor>(
+        _ctx, siblingPort,
+        [this](bool reachable) { siblingReachabilityChanged(reachable); },
+        30s, 5s, 5000ms);
+    _ctx.spawn(_siblingMonitor->run());
 #endif
 
+    if (_extDataIfaces->bmcRole() == ext_data::BMCRole::Active)
+    {
+        // The data received as the passive BMC may be changed hereafter, so
+        // the digests of it are not valid anymore.
+        std::error_code ec;
+        fs::remove(persist::ReceivedDigestsFile, ec);
+    }
+
     if (!_extDataIfaces->bmcRedundancy() || _syncBMCDataIface.disable_sync())
     {
         lg2::warning(
@@ -77,9 +109,19 @@ sdbusplus::async::task<> Manager::init()
         co_return;
     }
 
-    // TODO: Explore the possibility of running FullSync and Background Sync
-    //       concurrently
-    co_await startFullSync();
+    // Sync only the paths which were pending in the previous run, unless the
+    // sync journal is missing or corrupt and the changes might have been lost.
+    if (auto pendingPaths = _syncJournal.load(getConfigurationId());
+        pendingPaths.has_value())
+    {
+        co_await replaySyncJournal(std::move(*pendingPaths));
+    }
+    else
+    {
+        // TODO: Explore the possibility of running FullSync and Background
+        //       Sync concurrently
+        co_await startFullSync();
+    }
 
     co_await startSyncEvents();
 
@@ -195,11 +237,11 @@ sdbusplus::async::task<> Manager::monitorServiceNotifications()
             if (auto dataOperations = co_await notifyWatcher.onDataChange();
                 !dataOperations.empty())
             {
-                for (const auto& [path, Op] : dataOperations)
+                for (const auto& dataOperation : dataOperations)
                 {
                     _notifyReqs.emplace_back(
                         std::make_unique<notify::NotifyService>(
-                            _ctx, *_extDataIfaces, path,
+                            _ctx, *_extDataIfaces, dataOperation._path,
                             [this](notify::NotifyService* ptr) {
                         std::erase_if(_notifyReqs, [ptr](const auto& p) {
                             return p.get() == ptr;
@@ -229,6 +271,57 @@ sdbusplus::async::task<> Manager::monitorServiceNotifications()
     co_return;
 }
 
+uint64_t Manager::getConfigurationId() const
+{
+    std::vector<std::string> cfgKeys;
+    cfgKeys.reserve(_dataSyncConfiguration.size());
+    std::ranges::transform(_dataSyncConfiguration, std::back_inserter(cfgKeys),
+                           [](const auto& cfg) {
+        return std::format("{}:{}:{}:{}", cfg._path.string(),
+                           cfg._destPath.value_or(fs::path{}).string(),
+                           cfg.getSyncDirectionInStr(), cfg.getSyncTypeInStr());
+    });
+    std::ranges::sort(cfgKeys);
+    cfgKeys.emplace_back(_extDataIfaces->bmcRoleInStr());
+
+    uint64_t configId = utility::getStableHash("");
+    for (const auto& cfgKey : cfgKeys)
+    {
+        configId = utility::getStableHash(cfgKey, configId);
+        configId = utility::getStableHash("\n", configId);
+    }
+    return configId;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::replaySyncJournal(std::vector<fs::path> pendingPaths)
+{
+    lg2::info("Syncing {COUNT} path(s) pending in the sync journal", "COUNT",
+              pendingPaths.size());
+
+    std::vector<SyncEntry> entries;
+    for (const auto& path : pendingPaths)
+    {
+        auto cfg = std::ranges::find_if(_dataSyncConfiguration,
+                                        [&path](const auto& cfg) {
+            return utility::isSameOrChildPath(cfg._path, path);
+        });
+        if (cfg != _dataSyncConfiguration.end() && isSyncEligible(*cfg))
+        {
+            entries.emplace_back(&*cfg, path);
+        }
+        else
+        {
+            _syncJournal.trim(path, _syncJournal.sequence());
+        }
+    }
+
+    // NOLINTNEXTLINE
+    co_await syncBatch(std::move(entries));
+    co_return;
+}
+
 bool Manager::isSyncEligible(const config::DataSyncConfig& dataSyncCfg)
 {
     using enum config::SyncDirection;
@@ -258,15 +351,20 @@ bool Manager::isSyncEligible(const config::DataSyncConfig& dataSyncCfg)
 sdbusplus::async::task<> Manager::startSyncEvents()
 {
     lg2::info("Starting background sync.");
+    bool hasPeriodicSyncs{false};
     std::ranges::for_each(
         _dataSyncConfiguration |
             std::views::filter([this](const auto& dataSyncCfg) {
         return this->isSyncEligible(dataSyncCfg);
     }),
-        [this](const auto& dataSyncCfg) {
+        [this, &hasPeriodicSyncs](const auto& dataSyncCfg) {
         using enum config::SyncType;
         if (dataSyncCfg._syncType == Immediate)
         {
+            if (this->subscribeDataChanges(dataSyncCfg))
+            {
+                return;
+            }
             try
             {
                 this->_ctx.spawn(this->monitorDataToSync(dataSyncCfg));
@@ -281,19 +379,28 @@ sdbusplus::async::task<> Manager::startSyncEvents()
         }
         else if (dataSyncCfg._syncType == Periodic)
         {
-            try
-            {
-                this->_ctx.spawn(this->monitorTimerToSync(dataSyncCfg));
-            }
-            catch (const std::exception& e)
-            {
-                lg2::error("Failed to start periodic sync for {PATH}: "
-                           "{EXCEPTION}",
-                           "EXCEPTION", e, "PATH", dataSyncCfg._path);
-                setSyncEventsHealth(SyncEventsHealth::Critical);
-            }
+            hasPeriodicSyncs = true;
         }
     });
+
+    if (!_subscribers.empty() && !_dataChangesMonitored)
+    {
+        _ctx.spawn(monitorDataChanges());
+    }
+
+    if (hasPeriodicSyncs && !_periodicSyncsMonitored)
+    {
+        try
+        {
+            _ctx.spawn(monitorPeriodicSyncs());
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error("Failed to start periodic sync: {EXCEPTION}",
+                       "EXCEPTION", e);
+            setSyncEventsHealth(SyncEventsHealth::Critical);
+        }
+    }
     co_return;
 }
 
@@ -317,92 +424,242 @@ bool Manager::isRetryEligible(uint8_t errCode) noexcept
     }
 }
 
-// Disabled because this function conditionally accesses class members when
-// unit tests are not enabled.
-// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-void Manager::getRsyncCmd(RsyncMode mode,
-                          const config::DataSyncConfig& dataSyncCfg,
-                          const std::string& srcPath, std::string& cmd)
+rsync::RsyncJob
+    Manager::getRsyncJobTemplate(RsyncMode mode,
+                                 const config::DataSyncConfig& dataSyncCfg)
 {
-    using namespace std::string_literals;
-
-    cmd.append("rsync --compress --recursive --perms --group --owner --times "
-               "--atimes --update"s);
-    if (mode == RsyncMode::Sync)
+    std::vector<std::string> options{"--compress", "--recursive", "--perms",
+                                     "--group",    "--owner",     "--times",
+                                     "--atimes",   "--update"};
+    std::string destination{getSiblingRsyncURL()};
+    if (mode == RsyncMode::Sync || mode == RsyncMode::BatchSync ||
+        mode == RsyncMode::MoveSync || mode == RsyncMode::ShardRootSync ||
+        mode == RsyncMode::DryRunSync)
     {
         // Appending required flags to sync data between BMCs
         // For more details about CLI options, refer rsync man page.
         // https://download.samba.org/pub/rsync/rsync.1#OPTION_SUMMARY
 
-        cmd.append(" --relative --delete --delete-missing-args --stats"s);
+        options.insert(options.end(), {"--relative", "--delete",
+                                       "--delete-missing-args", "--stats"});
+
+        if (mode == RsyncMode::ShardRootSync)
+        {
+            // The subdirectories are synced by the shards.
+            options.insert(options.end(), {"--no-recursive", "--dirs"});
+        }
+        else if (mode == RsyncMode::DryRunSync)
+        {
+            // Only report the statistics of what would be transferred.
+            options.emplace_back("--dry-run");
+        }
+        else if (mode == RsyncMode::BatchSync || mode == RsyncMode::MoveSync)
+        {
+            // Read the NUL separated list of paths relative to the root from
+            // stdin, the --relative flag keeps the full path in the
+            // destination.
+            options.insert(options.end(), {"--files-from=-", "--from0"});
+
+            // Report the transferred items to notify only their entries.
+            options.emplace_back(utility::rsync::itemizeOutFormat);
+
+            if (mode == RsyncMode::MoveSync)
+            {
+                // Use the file of the same size and modification time, that
+                // is the old path of the renamed file, as the basis.
+                options.emplace_back("--fuzzy");
+            }
+        }
 
         if (dataSyncCfg._excludeList.has_value())
         {
-            cmd.append(dataSyncCfg._excludeList->second);
+            const auto& excludeFilters = dataSyncCfg._excludeList->second;
+            options.insert(options.end(), excludeFilters.begin(),
+                           excludeFilters.end());
         }
+
+        // Add destination data path if configured
+        destination.append(
+            dataSyncCfg._destPath.value_or(fs::path("")).string());
     }
     else if (mode == RsyncMode::Notify)
     {
         // Appending the required flags to notify the siblng
-        cmd.append(" --remove-source-files"s);
+        options.emplace_back("--remove-source-files");
+        destination.append(NOTIFY_SERVICES_DIR);
+    }
+
+    return {std::move(options), std::move(destination)};
+}
+
+rsync::RsyncJob Manager::getRsyncJob(RsyncMode mode,
+                                     const config::DataSyncConfig& dataSyncCfg,
+                                     const fs::path& srcPath)
+{
+    auto jobTemplate = _rsyncJobTemplates.find({&dataSyncCfg, mode});
+    if (jobTemplate == _rsyncJobTemplates.end())
+    {
+        jobTemplate =
+            _rsyncJobTemplates
+                .emplace(std::make_pair(&dataSyncCfg, mode),
+                         getRsyncJobTemplate(mode, dataSyncCfg))
+                .first;
     }
 
-    if (!srcPath.empty())
+    // The job shares the options and the destination with the template.
+    auto rsyncJob = jobTemplate->second;
+    if (mode == RsyncMode::BatchSync || mode == RsyncMode::MoveSync)
+    {
+        // The paths to sync are relative to the root.
+        rsyncJob.addSource("/");
+    }
+    else if (!srcPath.empty())
     {
         // Append the modified path name as its available
-        cmd.append(" "s + srcPath);
+        rsyncJob.addSource(srcPath);
     }
-    else if ((dataSyncCfg._includeList.has_value()) && (srcPath.empty()))
+    else if (dataSyncCfg._includeList.has_value())
     {
         // Build rsync command only for paths that currently exist in the
         // filesystem this avoids running rsync with invalid or missing source
         // paths
-        auto anyExist = std::ranges::fold_left(
-            dataSyncCfg._includeList.value() |
-                std::views::filter([](const fs::path& p) {
+        for (const auto& includePath : dataSyncCfg._includeList.value())
+        {
             std::error_code ec;
-            return fs::exists(p, ec);
-        }),
-            false, [&cmd]([[maybe_unused]] auto, const fs::path& p) {
-            cmd.append(" ");
-            cmd.append(p.string());
-            return true; // mark that at least one path exists
-        });
+            if (fs::exists(includePath, ec))
+            {
+                rsyncJob.addSource(includePath);
+            }
+        }
 
         // Skip sync if none of the configured include paths exist
         // Future inotify events will trigger sync once files appear
-        if (!anyExist)
+        if (!rsyncJob.hasSources())
         {
             lg2::debug(
                 "IncludeList: none of the configured source paths exist, skipping rsync");
-            cmd.clear();
-            return;
         }
     }
     else
     {
-        cmd.append(" "s + dataSyncCfg._path.string());
+        rsyncJob.addSource(dataSyncCfg._path);
     }
+    return rsyncJob;
+}
 
+// Disabled because this function conditionally accesses class members when
+// unit tests are not enabled.
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+std::string Manager::getSiblingRsyncURL()
+{
 #ifdef UNIT_TEST
-    cmd.append(" "s);
+    // The sibling is the local filesystem in the unit tests.
+    return {};
 #else
     static const std::string rsyncdURL(
-        std::format(" rsync://localhost:{}/{}",
+        std::format("rsync://localhost:{}/{}",
                     (_extDataIfaces->bmcPosition() == 0 ? BMC1_RSYNC_PORT
                                                         : BMC0_RSYNC_PORT),
                     RSYNCD_MODULE_NAME));
-    cmd.append(rsyncdURL);
+    return rsyncdURL;
 #endif
+}
 
-    if (mode == RsyncMode::Sync)
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::isSiblingUnreachable(int errCode)
+{
+    switch (errCode)
     {
-        // Add destination data path if configured
-        cmd.append(dataSyncCfg._destPath.value_or(fs::path("")).string());
+        case 5:  // error starting client-server protocol
+        case 10: // error in socket I/O
+        case 12: // error in rsync protocol data stream
+        case 30: // timeout in data send/receive
+        case 35: // timeout waiting for daemon connection
+            break;
+        default:
+            co_return false;
     }
-    else if (mode == RsyncMode::Notify)
+
+    if (!_siblingMonitor)
+    {
+        co_return false;
+    }
+    // NOLINTNEXTLINE
+    co_return !co_await _siblingMonitor->probe();
+}
+
+void Manager::siblingReachabilityChanged(bool reachable)
+{
+    _siblingReachable = reachable;
+    if (!reachable)
+    {
+        lg2::warning("Parking the syncs until the sibling BMC is reachable");
+        return;
+    }
+    drainParkedSyncs();
+}
+
+void Manager::parkSync(const config::DataSyncConfig& dataSyncCfg,
+                       const fs::path& srcPath)
+{
+    // The configuration is synced as a whole beyond this many parked paths.
+    constexpr size_t maxParkedPaths = 256;
+
+    auto& parkedPaths = _parkedSyncs[&dataSyncCfg];
+    if (parkedPaths.contains(fs::path{}))
+    {
+        return;
+    }
+    if (srcPath.empty() || srcPath == dataSyncCfg._path ||
+        parkedPaths.size() >= maxParkedPaths)
+    {
+        parkedPaths = {fs::path{}};
+        return;
+    }
+    parkedPaths.emplace(srcPath);
+}
+
+void Manager::drainParkedSyncs()
+{
+    if (_parkedSyncs.empty())
+    {
+        return;
+    }
+    lg2::info("Syncing the paths of [{COUNT}] configurations parked while "
+              "the sibling BMC was not reachable",
+              "COUNT", _parkedSyncs.size());
+
+    std::vector<SyncEntry> entries;
+    for (const auto& [dataSyncCfg, parkedPaths] :
+         std::exchange(_parkedSyncs, {}))
+    {
+        for (const auto& path : parkedPaths)
+        {
+            if (!path.empty())
+            {
+                entries.emplace_back(dataSyncCfg, path);
+            }
+            else if (dataSyncCfg->_includeList.has_value())
+            {
+                // Only the existing include paths are synced by its own
+                // rsync.
+                // NOLINTNEXTLINE
+                _ctx.spawn(syncData(*dataSyncCfg) |
+                           stdexec::then([]([[maybe_unused]] bool result) {}));
+            }
+            else
+            {
+                entries.emplace_back(dataSyncCfg, dataSyncCfg->_path);
+            }
+        }
+    }
+
+    if (!entries.empty())
     {
-        cmd.append(NOTIFY_SERVICES_DIR);
+        // NOLINTNEXTLINE
+        _ctx.spawn(syncBatch(std::move(entries)) |
+                   stdexec::then([]([[maybe_unused]] bool result) {}));
     }
 }
 
@@ -462,24 +719,42 @@ sdbusplus::async::task<void>
 sdbusplus::async::task<bool>
     // NOLINTNEXTLINE
     Manager::retrySync(const config::DataSyncConfig& cfg, fs::path srcPath,
-                       size_t retryCount)
+                       size_t retryCount, RsyncMode mode,
+                       async::SyncPriority priority, SyncResult* syncResult)
 {
     const fs::path currentSrcPath = srcPath.empty() ? cfg._path : srcPath;
 
     if (cfg._retry.has_value() && retryCount++ < cfg._retry->_maxRetryAttempts)
     {
+        const auto backoff = async::RetryQueue::getBackoff(
+            cfg._retry->_retryIntervalInSec, retryCount,
+            std::chrono::seconds(MAX_RETRY_INTERVAL));
         lg2::debug(
             "Retry [{RETRY_ATTEMPT}/{MAX_ATTEMPTS}] for [{SRC_PATH}] after "
-            "[{RETRY_INTERVAL}s]",
+            "[{RETRY_INTERVAL_MS}ms]",
             "RETRY_ATTEMPT", retryCount, "MAX_ATTEMPTS",
             cfg._retry->_maxRetryAttempts, "SRC_PATH", currentSrcPath,
-            "RETRY_INTERVAL", cfg._retry->_retryIntervalInSec.count());
+            "RETRY_INTERVAL_MS", backoff.count());
 
-        co_await sleep_for(_ctx, std::chrono::seconds(
-                                     cfg._retry->_retryIntervalInSec.count()));
+        // NOLINTNEXTLINE
+        auto outcome = co_await _retryQueue.wait(cfg._path, currentSrcPath,
+                                                 backoff);
+        if (outcome != async::RetryOutcome::Due)
+        {
+            lg2::debug("Retry for [{SRC_PATH}] is covered by another sync, "
+                       "synced : {SYNCED}",
+                       "SRC_PATH", currentSrcPath, "SYNCED",
+                       outcome == async::RetryOutcome::Synced);
+            co_return outcome == async::RetryOutcome::Synced;
+        }
 
         // NOLINTNEXTLINE
-        co_return co_await syncData(cfg, std::move(srcPath), retryCount);
+        auto result = co_await runSync(cfg, std::move(srcPath), retryCount,
+                                       mode, priority, syncResult);
+
+        // The coalesced retries get the final result of this retry.
+        _retryQueue.complete(cfg._path, currentSrcPath, result);
+        co_return result;
     }
     co_return false;
 }
@@ -487,58 +762,115 @@ sdbusplus::async::task<bool>
 sdbusplus::async::task<bool>
     // NOLINTNEXTLINE
     Manager::syncData(const config::DataSyncConfig& dataSyncCfg,
-                      fs::path srcPath, size_t retryCount)
+                      fs::path srcPath, RsyncMode mode,
+                      async::SyncPriority priority, SyncResult* syncResult)
 {
-    // Don't sync if the sync is disabled
-    if (_syncBMCDataIface.disable_sync())
-    {
-        co_return false;
-    }
-
     using std::experimental::scope_exit;
     const fs::path currentSrcPath = srcPath.empty() ? dataSyncCfg._path
                                                     : srcPath;
 
+    if (auto inProgress =
+            dataSyncCfg._syncInProgressPaths.find(currentSrcPath);
+        inProgress != dataSyncCfg._syncInProgressPaths.end())
+    {
+        // The in-progress sync might have already transferred the path,
+        // hence sync it once again after the in-progress sync.
+        lg2::debug("Sync for [{SRC}] is in progress, syncing again after it",
+                   "SRC", currentSrcPath);
+        inProgress->second = true;
+        co_return true;
+    }
+    dataSyncCfg._syncInProgressPaths.emplace(currentSrcPath, false);
+
     auto cleanup = scope_exit([&dataSyncCfg, &currentSrcPath]() noexcept {
-        // remove this path from the in-progress set once the first(main)
-        // attempt completes
+        // remove this path from the in-progress set once the sync including
+        // its retries and the follow-up sync completes
         dataSyncCfg._syncInProgressPaths.erase(currentSrcPath);
     });
 
-    if (retryCount == 0)
+    bool result{false};
+    do
     {
-        if (dataSyncCfg._syncInProgressPaths.contains(currentSrcPath))
-        {
-            lg2::debug("Skipping sync for [{SRC}]: already in progress", "SRC",
-                       currentSrcPath);
-            cleanup.release(); // nothing inserted, skip cleanup
-            co_return true;
-        }
-        dataSyncCfg._syncInProgressPaths.emplace(currentSrcPath);
+        dataSyncCfg._syncInProgressPaths.at(currentSrcPath) = false;
+        // NOLINTNEXTLINE
+        result = co_await runSync(dataSyncCfg, srcPath, 0, mode, priority,
+                                  syncResult);
+    } while (dataSyncCfg._syncInProgressPaths.at(currentSrcPath) &&
+             !_syncBMCDataIface.disable_sync());
+
+    co_return result;
+}
+
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::runSync(const config::DataSyncConfig& dataSyncCfg,
+                     fs::path srcPath, size_t retryCount, RsyncMode mode,
+                     async::SyncPriority priority, SyncResult* syncResult)
+{
+    // Don't sync if the sync is disabled
+    if (_syncBMCDataIface.disable_sync())
+    {
+        co_return false;
     }
-    else
+
+    // Park the sync rather than running rsync which can't connect.
+    if (!_siblingReachable)
     {
-        // skip cleanup for retries, the main attempt will handle it
-        cleanup.release();
+        parkSync(dataSyncCfg, srcPath);
+        co_return false;
     }
 
-    std::string syncCmd{};
-    getRsyncCmd(RsyncMode::Sync, dataSyncCfg, srcPath.string(), syncCmd);
+    const fs::path currentSrcPath = srcPath.empty() ? dataSyncCfg._path
+                                                    : srcPath;
 
-    if (syncCmd.empty())
+    // The paths recorded after this are not covered by this sync.
+    const auto journalSequence = _syncJournal.sequence();
+
+    const auto rsyncJob = getRsyncJob(mode, dataSyncCfg, srcPath);
+    if (!rsyncJob.hasSources())
     {
         co_return true;
     }
 
-    lg2::debug("Rsync command: {CMD}", "CMD", syncCmd);
+    lg2::debug("Rsync command: {CMD}", "CMD", rsyncJob.toString());
 
-    data_sync::async::AsyncCommandExecutor executor(_ctx);
-    // NOLINTNEXTLINE
-    auto result = co_await executor.execCmd(syncCmd);
+    std::pair<int, std::string> result{-1, ""};
+    std::vector<fs::path> foldedRetries;
+    {
+        // Hold the slot only while rsync runs so that the retry interval and
+        // the sibling notification don't occupy it.
+        // NOLINTNEXTLINE
+        auto slot = co_await _syncScheduler.acquire(priority,
+                                                    dataSyncCfg._path);
+
+        // The sync of the whole configuration covers its pending retries.
+        if (mode == RsyncMode::Sync && srcPath.empty())
+        {
+            foldedRetries = _retryQueue.fold(dataSyncCfg._path);
+        }
+        data_sync::async::AsyncCommandExecutor executor(_ctx);
+        // NOLINTNEXTLINE
+        result = co_await executor.execCmd(rsyncJob.getArgv());
+    }
     lg2::debug(
         "Rsync cmd output for [{PATH}] : return code : {RET} : output : {OUTPUT}",
         "PATH", currentSrcPath, "RET", result.first, "OUTPUT", result.second);
 
+    for (const auto& foldedRetry : foldedRetries)
+    {
+        _retryQueue.complete(dataSyncCfg._path, foldedRetry,
+                             result.first == 0 || result.first == 24);
+    }
+
+    if (syncResult != nullptr)
+    {
+        syncResult->_exitCode = result.first;
+        syncResult->_transferredBytes +=
+            utility::rsync::getTransferredDataBytes(result.second);
+        syncResult->_totalFileSize =
+            utility::rsync::getTotalFileSizeBytes(result.second);
+    }
+
     ext_data::AdditionalData additionalDetails = {
         {"BMC_Role", _extDataIfaces->bmcRoleInStr()},
         {"DS_Sync_Path", currentSrcPath.string()},
@@ -553,6 +885,8 @@ sdbusplus::async::task<bool>
     {
         case 0: // Success
         {
+            _syncJournal.trim(currentSrcPath, journalSequence);
+
             // Notify only if configured, we know the concrete path,
             // and bytes > 0
             if (dataSyncCfg._notifySibling &&
@@ -577,18 +911,26 @@ sdbusplus::async::task<bool>
             lg2::debug(
                 "Rsync exited with vanished file error for [{SRC}], treating as success",
                 "SRC", currentSrcPath);
+            _syncJournal.trim(currentSrcPath, journalSequence);
             co_return true;
         }
 
         default:
         {
+            // NOLINTNEXTLINE
+            if (co_await isSiblingUnreachable(result.first))
+            {
+                parkSync(dataSyncCfg, srcPath);
+                co_return false;
+            }
+
             if (!isRetryEligible(result.first))
             {
                 lg2::error(
                     "Error syncing [{PATH}], ErrCode: {ERRCODE}, ErrMsg: {ERRMSG}"
                     "SyncCmd : [{SYNC_CMD}]",
                     "PATH", currentSrcPath, "ERRCODE", result.first, "ERRMSG",
-                    result.second, "SYNC_CMD", syncCmd);
+                    result.second, "SYNC_CMD", rsyncJob.toString());
                 // Mark sync event health as critical when a non-retryable
                 // (permanent) sync error occurs.
                 setSyncEventsHealth(SyncEventsHealth::Critical);
@@ -612,7 +954,7 @@ sdbusplus::async::task<bool>
 
             auto retrySuccess = co_await retrySync(
                 dataSyncCfg, srcPath.empty() ? fs::path{} : currentSrcPath,
-                retryCount);
+                retryCount, mode, priority, syncResult);
             if (dataSyncCfg._retry.has_value() && !retrySuccess &&
                 retryCount >= dataSyncCfg._retry->_maxRetryAttempts)
             {
@@ -624,7 +966,7 @@ sdbusplus::async::task<bool>
                         ? dataSyncCfg._retry.value()._maxRetryAttempts
                         : 0,
                     "SRC_PATH", currentSrcPath, "ERRCODE", result.first,
-                    "ERRMSG", result.second, "SYNC_CMD", syncCmd);
+                    "ERRMSG", result.second, "SYNC_CMD", rsyncJob.toString());
 
                 // All retry attempts exhausted, mark sync event health as
                 // critical
@@ -643,45 +985,455 @@ sdbusplus::async::task<bool>
     }
 }
 
-sdbusplus::async::task<>
-    Manager::syncNotifyRequest(const config::DataSyncConfig& cfg,
-                               const fs::path& modifiedPath,
-                               const fs::path& notifyPath)
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::syncDataChanges(std::vector<SyncEntry> entries,
+                             std::vector<SyncEntry> movedEntries)
 {
-    std::string notifyCmd{};
-    getRsyncCmd(RsyncMode::Notify, cfg, notifyPath.string(), notifyCmd);
-    lg2::debug("Sync sibling notify request cmd : {CMD}", "CMD", notifyCmd);
+    bool result{true};
+    if (!movedEntries.empty())
+    {
+        lg2::debug("Syncing [{COUNT}] renamed/moved paths", "COUNT",
+                   movedEntries.size());
 
-    std::pair<int, std::string> result{-1, ""};
-    // retryAttempts = 0 indicates initial attempt, if fails retry happens
-    uint8_t retryAttempts = 0;
-    while (cfg._retry.has_value() &&
-           retryAttempts++ <= cfg._retry->_maxRetryAttempts)
+        // The old paths must be in the sibling while syncing the new paths
+        // to use them as the basis, hence those are synced by the batch
+        // after.
+        // NOLINTNEXTLINE
+        result = co_await syncBatch(std::move(movedEntries),
+                                    async::SyncPriority::Immediate,
+                                    RsyncMode::MoveSync);
+    }
+
+    if (!entries.empty())
     {
-        data_sync::async::AsyncCommandExecutor executor(_ctx);
-        result = co_await executor.execCmd(notifyCmd);
+        // NOLINTNEXTLINE
+        result &= co_await syncBatch(std::move(entries));
+    }
+    co_return result;
+}
 
-        switch (result.first)
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::syncBatch(std::vector<SyncEntry> entries,
+                       async::SyncPriority priority, RsyncMode mode)
+{
+    // Don't sync if the sync is disabled
+    if (_syncBMCDataIface.disable_sync())
+    {
+        co_return false;
+    }
+
+    // Group the entries which can be synced by the same rsync command.
+    using DestPath = std::string;
+    using ExcludeFilter = std::vector<std::string>;
+    std::map<std::pair<DestPath, ExcludeFilter>, std::vector<SyncEntry>>
+        groups;
+    for (auto& entry : entries)
+    {
+        const auto& cfg = *entry._cfg;
+        groups[{cfg._destPath.value_or(fs::path{}).string(),
+                cfg._excludeList.has_value() ? cfg._excludeList->second
+                                             : ExcludeFilter{}}]
+            .emplace_back(std::move(entry));
+    }
+
+    bool result{true};
+    for (const auto& [key, groupEntries] : groups)
+    {
+        // The moved paths are synced only by the batch since the rsync
+        // command of a single path has no --fuzzy.
+        if (groupEntries.size() == 1 && mode == RsyncMode::BatchSync)
         {
-            case 0: // Success
-            {
-                lg2::debug(
-                    "Successfully send notify request[{NOTIFYPATH}] to the sibling BMC "
-                    "for the path[{PATH}]",
-                    "NOTIFYPATH", notifyPath, "PATH", modifiedPath);
-                co_return;
-            }
+            // NOLINTNEXTLINE
+            result &= co_await syncData(*groupEntries.front()._cfg,
+                                        groupEntries.front()._path,
+                                        RsyncMode::Sync, priority);
+            continue;
+        }
+        // NOLINTNEXTLINE
+        result &= co_await syncBatchGroup(groupEntries, priority, mode);
+    }
+    co_return result;
+}
 
-            case 24: // Vanished source
-            {
-                lg2::error(
-                    "Notify Request[{NOTIFYPATH}] to sibling BMC exited with vanished "
-                    "file error for the path [{PATH}], treating as permanent error.",
-                    "NOTIFYPATH", notifyPath, "PATH", modifiedPath);
-                co_return;
-            }
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::syncBatchGroup(const std::vector<SyncEntry>& entries,
+                            async::SyncPriority priority, RsyncMode mode)
+{
+    using std::experimental::scope_exit;
 
-            default:
+    // Skip the paths which are already in progress to sync them again after
+    // their in-progress sync, and mark the rest as in progress until the
+    // batch including its retries and the follow-up syncs completes.
+    std::vector<SyncEntry> batchEntries;
+    for (const auto& entry : entries)
+    {
+        auto& syncInProgressPaths = entry._cfg->_syncInProgressPaths;
+        if (auto inProgress = syncInProgressPaths.find(entry._path);
+            inProgress != syncInProgressPaths.end())
+        {
+            lg2::debug(
+                "Sync for [{SRC}] is in progress, syncing again after it",
+                "SRC", entry._path);
+            inProgress->second = true;
+            continue;
+        }
+        syncInProgressPaths.emplace(entry._path, false);
+        batchEntries.emplace_back(entry);
+    }
+
+    auto cleanup = scope_exit([&batchEntries]() noexcept {
+        for (const auto& entry : batchEntries)
+        {
+            entry._cfg->_syncInProgressPaths.erase(entry._path);
+        }
+    });
+
+    bool result{true};
+    auto syncEntries = batchEntries;
+    while (!syncEntries.empty())
+    {
+        for (const auto& entry : syncEntries)
+        {
+            entry._cfg->_syncInProgressPaths.at(entry._path) = false;
+        }
+
+        // NOLINTNEXTLINE
+        result &= co_await runBatchSync(syncEntries, priority, nullptr,
+                                        mode);
+
+        if (_syncBMCDataIface.disable_sync())
+        {
+            break;
+        }
+
+        // Sync again only the paths which are modified during the sync.
+        std::erase_if(syncEntries, [](const auto& entry) {
+            return !entry._cfg->_syncInProgressPaths.at(entry._path);
+        });
+    }
+    co_return result;
+}
+
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::runBatchSync(const std::vector<SyncEntry>& batchEntries,
+                          async::SyncPriority priority, SyncResult* syncResult,
+                          RsyncMode mode)
+{
+    // The entries still to sync, the entries which got covered by another
+    // sync while waiting for their retry are dropped.
+    std::vector<SyncEntry> entries = batchEntries;
+
+    // The list of paths relative to the root, separated by NUL.
+    std::string filesFrom;
+    std::string syncPaths;
+    auto setSyncPaths = [&entries, &filesFrom, &syncPaths]() {
+        filesFrom.clear();
+        syncPaths.clear();
+        for (const auto& entry : entries)
+        {
+            filesFrom.append(entry._path.relative_path().string());
+            filesFrom.push_back('\0');
+            syncPaths.append(syncPaths.empty() ? "" : ",");
+            syncPaths.append(entry._path.string());
+        }
+    };
+    setSyncPaths();
+
+    // All the entries in the group share the same rsync command.
+    const auto& groupCfg = *batchEntries.front()._cfg;
+    const auto rsyncJob = getRsyncJob(mode, groupCfg, {});
+
+    lg2::debug("Rsync command: {CMD} for [{COUNT}] paths", "CMD",
+               rsyncJob.toString(), "COUNT", batchEntries.size());
+
+    // Retry as per the most tolerant retry configuration in the batch.
+    size_t maxRetryAttempts = 0;
+    std::chrono::seconds retryInterval{0};
+    for (const auto& entry : batchEntries)
+    {
+        if (entry._cfg->_retry.has_value())
+        {
+            maxRetryAttempts = std::max<size_t>(
+                maxRetryAttempts, entry._cfg->_retry->_maxRetryAttempts);
+            retryInterval = std::max(retryInterval,
+                                     entry._cfg->_retry->_retryIntervalInSec);
+        }
+    }
+
+    auto trimJournal =
+        [this, &entries](persist::SyncJournal::Sequence sequence) {
+        for (const auto& entry : entries)
+        {
+            _syncJournal.trim(entry._path, sequence);
+        }
+    };
+
+    auto parkBatch = [this, &entries]() {
+        for (const auto& entry : entries)
+        {
+            parkSync(*entry._cfg, entry._path);
+        }
+    };
+
+    // Whether the entries are the retries which were due for this batch, so
+    // that the coalesced retries get the final result of the batch.
+    bool retrying = false;
+    auto completeRetries = [this, &entries, &retrying](bool synced) {
+        if (!retrying)
+        {
+            return;
+        }
+        for (const auto& entry : entries)
+        {
+            _retryQueue.complete(entry._cfg->_path, entry._path, synced);
+        }
+    };
+
+    // Whether the dropped entries got synced by the sync which covered them.
+    bool coveredSynced = true;
+
+    std::pair<int, std::string> result{-1, ""};
+    for (size_t retryCount = 0; !_syncBMCDataIface.disable_sync();
+         ++retryCount)
+    {
+        // Park the batch rather than running rsync which can't connect.
+        if (!_siblingReachable)
+        {
+            parkBatch();
+            completeRetries(false);
+            co_return false;
+        }
+
+        // The paths recorded after this are not covered by this attempt.
+        const auto journalSequence = _syncJournal.sequence();
+
+        // The pending retries of the configurations in the batch are synced
+        // along with the batch instead of by their own rsync.
+        std::vector<SyncEntry> foldedRetries;
+        auto attemptFilesFrom = filesFrom;
+        {
+            // NOLINTNEXTLINE
+            auto slot = co_await _syncScheduler.acquire(priority,
+                                                        groupCfg._path);
+            for (const auto& entry : entries)
+            {
+                for (auto& path : _retryQueue.fold(entry._cfg->_path))
+                {
+                    attemptFilesFrom.append(path.relative_path().string());
+                    attemptFilesFrom.push_back('\0');
+                    foldedRetries.emplace_back(entry._cfg, std::move(path));
+                }
+            }
+            data_sync::async::AsyncCommandExecutor executor(_ctx);
+            // NOLINTNEXTLINE
+            result = co_await executor.execCmd(rsyncJob.getArgv(),
+                                               attemptFilesFrom);
+        }
+        lg2::debug(
+            "Rsync cmd output for [{PATHS}] : return code : {RET} : output : "
+            "{OUTPUT}",
+            "PATHS", syncPaths, "RET", result.first, "OUTPUT", result.second);
+
+        const bool synced = result.first == 0 || result.first == 24;
+        for (const auto& foldedRetry : foldedRetries)
+        {
+            if (synced)
+            {
+                _syncJournal.trim(foldedRetry._path, journalSequence);
+            }
+            _retryQueue.complete(foldedRetry._cfg->_path, foldedRetry._path,
+                                 synced);
+        }
+
+        if (syncResult != nullptr)
+        {
+            syncResult->_exitCode = result.first;
+            syncResult->_transferredBytes +=
+                utility::rsync::getTransferredDataBytes(result.second);
+            syncResult->_totalFileSize =
+                utility::rsync::getTotalFileSizeBytes(result.second);
+        }
+
+        if (result.first == 0)
+        {
+            trimJournal(journalSequence);
+            completeRetries(true);
+
+            // Rsync success alone doesn’t guarantee data got updated on the
+            // remote, so notify only the entries whose data got transferred.
+            const auto transferredPaths =
+                utility::rsync::getTransferredPaths(result.second);
+            for (const auto& entry : entries)
+            {
+                if (entry._cfg->_notifySibling &&
+                    std::ranges::any_of(transferredPaths,
+                                        [&entry](const auto& path) {
+                    return utility::isSameOrChildPath(entry._path,
+                                                      fs::path{"/"} / path);
+                }))
+                {
+                    // NOLINTNEXTLINE
+                    co_await triggerSiblingNotification(*entry._cfg,
+                                                        entry._path.string());
+                }
+            }
+            co_return coveredSynced;
+        }
+
+        if (result.first == 24)
+        {
+            // Vanished source: treat as success
+            lg2::debug("Rsync exited with vanished file error for [{SRC}], "
+                       "treating as success",
+                       "SRC", syncPaths);
+            trimJournal(journalSequence);
+            completeRetries(true);
+            co_return coveredSynced;
+        }
+
+        // NOLINTNEXTLINE
+        if (co_await isSiblingUnreachable(result.first))
+        {
+            parkBatch();
+            completeRetries(false);
+            co_return false;
+        }
+
+        if (!isRetryEligible(result.first) || retryCount >= maxRetryAttempts)
+        {
+            break;
+        }
+
+        const auto backoff = async::RetryQueue::getBackoff(
+            retryInterval, retryCount + 1,
+            std::chrono::seconds(MAX_RETRY_INTERVAL));
+        lg2::debug(
+            "Retry [{RETRY_ATTEMPT}/{MAX_ATTEMPTS}] for [{SRC_PATH}] after "
+            "[{RETRY_INTERVAL_MS}ms], ErrCode: {ERRCODE}",
+            "RETRY_ATTEMPT", retryCount + 1, "MAX_ATTEMPTS", maxRetryAttempts,
+            "SRC_PATH", syncPaths, "RETRY_INTERVAL_MS", backoff.count(),
+            "ERRCODE", result.first);
+
+        // Queue each entry under its configuration so that it coalesces
+        // with the retries of the same path and can be folded into the next
+        // sync of the configuration. The entries are waited one after
+        // another, hence all of them are due at the same time.
+        const auto due = std::chrono::steady_clock::now() + backoff;
+        std::vector<SyncEntry> dueEntries;
+        for (auto& entry : entries)
+        {
+            const auto remaining = std::max(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    due - std::chrono::steady_clock::now()),
+                std::chrono::milliseconds(0));
+            // NOLINTNEXTLINE
+            auto outcome = co_await _retryQueue.wait(entry._cfg->_path,
+                                                     entry._path, remaining);
+            if (outcome == async::RetryOutcome::Due)
+            {
+                dueEntries.emplace_back(std::move(entry));
+                continue;
+            }
+
+            lg2::debug("Retry for [{SRC_PATH}] is covered by another sync, "
+                       "synced : {SYNCED}",
+                       "SRC_PATH", entry._path, "SYNCED",
+                       outcome == async::RetryOutcome::Synced);
+            coveredSynced = coveredSynced &&
+                            outcome == async::RetryOutcome::Synced;
+        }
+        entries = std::move(dueEntries);
+        retrying = true;
+
+        if (entries.empty())
+        {
+            co_return coveredSynced;
+        }
+        setSyncPaths();
+    }
+
+    completeRetries(false);
+    if (_syncBMCDataIface.disable_sync())
+    {
+        co_return false;
+    }
+
+    lg2::error("Error syncing [{PATH}], ErrCode: {ERRCODE}, ErrMsg: {ERRMSG}"
+               "SyncCmd : [{SYNC_CMD}]",
+               "PATH", syncPaths, "ERRCODE", result.first, "ERRMSG",
+               result.second, "SYNC_CMD", rsyncJob.toString());
+
+    // Mark sync event health as critical when a permanent sync error occurs
+    // or all retry attempts are exhausted.
+    setSyncEventsHealth(SyncEventsHealth::Critical);
+
+    ext_data::AdditionalData additionalDetails = {
+        {"BMC_Role", _extDataIfaces->bmcRoleInStr()},
+        {"DS_Sync_Path", syncPaths},
+        {"DS_Sync_ErrCode", std::to_string(result.first)},
+        {"DS_Sync_ErrMsg", result.second}};
+
+    additionalDetails["DS_Sync_Type"] = groupCfg.getSyncTypeInStr();
+    additionalDetails["DS_Sync_Direction"] = groupCfg.getSyncDirectionInStr();
+    additionalDetails["DS_Sync_Msg"] =
+        isRetryEligible(result.first)
+            ? "Maximum retries exceeded, sync failed for the paths"
+            : "Permanent rsync failure occurred for the paths";
+
+    co_await _extDataIfaces->createErrorLog(
+        "xyz.openbmc_project.RBMC_DataSync.Error.SyncFailure",
+        ext_data::ErrorLevel::Warning, additionalDetails);
+
+    co_return false;
+}
+
+sdbusplus::async::task<>
+    Manager::syncNotifyRequest(const config::DataSyncConfig& cfg,
+                               const fs::path& modifiedPath,
+                               const fs::path& notifyPath)
+{
+    const auto notifyJob = getRsyncJob(RsyncMode::Notify, cfg, notifyPath);
+    lg2::debug("Sync sibling notify request cmd : {CMD}", "CMD",
+               notifyJob.toString());
+
+    std::pair<int, std::string> result{-1, ""};
+    // retryAttempts = 0 indicates initial attempt, if fails retry happens
+    uint8_t retryAttempts = 0;
+    while (cfg._retry.has_value() &&
+           retryAttempts++ <= cfg._retry->_maxRetryAttempts)
+    {
+        {
+            auto slot = co_await _syncScheduler.acquire(
+                async::SyncPriority::Notify, cfg._path);
+            data_sync::async::AsyncCommandExecutor executor(_ctx);
+            result = co_await executor.execCmd(notifyJob.getArgv());
+        }
+
+        switch (result.first)
+        {
+            case 0: // Success
+            {
+                lg2::debug(
+                    "Successfully send notify request[{NOTIFYPATH}] to the sibling BMC "
+                    "for the path[{PATH}]",
+                    "NOTIFYPATH", notifyPath, "PATH", modifiedPath);
+                co_return;
+            }
+
+            case 24: // Vanished source
+            {
+                lg2::error(
+                    "Notify Request[{NOTIFYPATH}] to sibling BMC exited with vanished "
+                    "file error for the path [{PATH}], treating as permanent error.",
+                    "NOTIFYPATH", notifyPath, "PATH", modifiedPath);
+                co_return;
+            }
+
+            default:
             {
                 if (!isRetryEligible(result.first))
                 {
@@ -690,7 +1442,7 @@ sdbusplus::async::task<>
                         "Modified_path={MOD_PATH}, ErrCode{ERRCODE}, ErrMsg : {ERRMSG}, syncCmd :[{SYNCCMD}]",
                         "NOTIFYPATH", notifyPath, "MOD_PATH", modifiedPath,
                         "ERRCODE", result.first, "ERRMSG", result.second,
-                        "SYNCCMD", notifyCmd);
+                        "SYNCCMD", notifyJob.toString());
                     co_return;
                 }
             }
@@ -719,7 +1471,7 @@ sdbusplus::async::task<>
                "Modified path: {MODIFIEDPATH}, syncCmd : [{SYNCCMD}]",
                "NOTIFYPATH", notifyPath, "TOTAL_ATTEMPTS", retryAttempts,
                "ERRCODE", result.first, "ERRMSG", result.second, "MODIFIEDPATH",
-               modifiedPath, "SYNCCMD", notifyCmd);
+               modifiedPath, "SYNCCMD", notifyJob.toString());
 
     ext_data::AdditionalData additionalDetails = {
         {"BMC_Role", _extDataIfaces->bmcRoleInStr()},
@@ -733,148 +1485,1264 @@ sdbusplus::async::task<>
     co_return;
 }
 
-sdbusplus::async::task<>
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::monitorDataToSync(const config::DataSyncConfig& dataSyncCfg)
+{
+    bool exception{false};
+    bool restartWatcher{false};
+    try
+    {
+        auto eventMasksToWatch = getEventMasksToWatch(dataSyncCfg);
+
+        auto [it, inserted] = _activeWatchers.emplace(
+            dataSyncCfg._path,
+            std::make_unique<watch::inotify::DataWatcher>(
+                _ctx, IN_NONBLOCK | IN_CLOEXEC, eventMasksToWatch,
+                dataSyncCfg._path, dataSyncCfg._excludeMatcher,
+                dataSyncCfg._includeMatcher));
+
+        auto* dataWatcher = it->second.get();
+
+        // Ensure removal on scope exit
+        auto cleanup = std::experimental::scope_exit([this, &dataSyncCfg]() {
+            _activeWatchers.erase(dataSyncCfg._path);
+        });
+
+        while (!_ctx.stop_requested() && !_syncBMCDataIface.disable_sync())
+        {
+            // NOLINTNEXTLINE
+            if (auto dataOperations = co_await dataWatcher->onDataChange();
+                !dataOperations.empty())
+            {
+                // Sync all the operations of this wakeup as one batch
+                std::vector<SyncEntry> entries;
+                std::vector<SyncEntry> movedEntries;
+                processDataOperations(dataSyncCfg, dataOperations, entries,
+                                      movedEntries);
+                if (!entries.empty() || !movedEntries.empty())
+                {
+                    // NOLINTNEXTLINE
+                    _ctx.spawn(
+                        syncDataChanges(std::move(entries),
+                                        std::move(movedEntries)) |
+                        stdexec::then([]([[maybe_unused]] bool result) {}));
+                }
+
+                // Recreate the watcher so that the raised queued events limit
+                // is applied and the watches are placed on the current tree.
+                if (watch::isResyncRequired(dataOperations))
+                {
+                    ++_queueOverflowCount;
+                    restartWatcher = true;
+                    break;
+                }
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        lg2::error("Failed to create watcher object for {PATH}. Exception : "
+                   "{ERROR}",
+                   "PATH", dataSyncCfg._path, "ERROR", e.what());
+        exception = true;
+    }
+    if (exception)
+    {
+        ext_data::AdditionalData additionalDetails = {
+            {"DS_Events_Path", dataSyncCfg._path.string()},
+            {"DS_Events_Msg",
+             "Exception: Failed to create inotify watcher for the configured path"}};
+        co_await _extDataIfaces->createErrorLog(
+            "xyz.openbmc_project.RBMC_DataSync.Error.SyncEventsFailure",
+            ext_data::ErrorLevel::Warning, additionalDetails);
+    }
+
+    if (restartWatcher)
+    {
+        // NOLINTNEXTLINE
+        _ctx.spawn(monitorDataToSync(dataSyncCfg));
+    }
+    co_return;
+}
+
+uint32_t
+    Manager::getEventMasksToWatch(const config::DataSyncConfig& dataSyncCfg)
+{
+    uint32_t eventMasksToWatch = IN_CLOSE_WRITE | IN_MOVE | IN_DELETE_SELF;
+    if (dataSyncCfg._isPathDir)
+    {
+        eventMasksToWatch |= IN_CREATE | IN_DELETE;
+    }
+    return eventMasksToWatch;
+}
+
+void Manager::processDataOperations(
+    const config::DataSyncConfig& dataSyncCfg,
+    const watch::DataOperations& dataOperations,
+    std::vector<SyncEntry>& entries, std::vector<SyncEntry>& movedEntries)
+{
+    // Record before the syncs are scheduled so that a restart syncs the
+    // paths whose syncs didn't complete.
+    std::vector<fs::path> modifiedPaths;
+    if (watch::isResyncRequired(dataOperations))
+    {
+        modifiedPaths.emplace_back(dataSyncCfg._path);
+    }
+    else
+    {
+        for (const auto& dataOperation : dataOperations)
+        {
+            if (dataOperation._dataOp == watch::DataOps::MOVE)
+            {
+                modifiedPaths.emplace_back(dataOperation._movedFromPath);
+            }
+            modifiedPaths.emplace_back(dataOperation._path);
+        }
+    }
+    _syncJournal.record(modifiedPaths);
+
+    if (watch::isResyncRequired(dataOperations))
+    {
+        // The events are lost, hence sync the whole configured path instead
+        // of the received paths.
+        lg2::warning("Events lost for [{PATH}], resyncing the configured path",
+                     "PATH", dataSyncCfg._path);
+        // NOLINTNEXTLINE
+        _ctx.spawn(syncData(dataSyncCfg) |
+                   stdexec::then([]([[maybe_unused]] bool result) {}));
+        return;
+    }
+
+    if (dataSyncCfg._debounce.has_value())
+    {
+        // The moves are synced as a delete and a copy along with the other
+        // modified paths once the debounce window closes.
+        for (const auto& dataOperation : dataOperations)
+        {
+            if (dataOperation._dataOp == watch::DataOps::MOVE)
+            {
+                scheduleDebouncedSync(dataSyncCfg,
+                                      dataOperation._movedFromPath);
+            }
+            scheduleDebouncedSync(dataSyncCfg, dataOperation._path);
+        }
+        return;
+    }
+
+    auto addEntry = [&dataSyncCfg](std::vector<SyncEntry>& syncEntries,
+                                   const fs::path& path) {
+        if (std::ranges::none_of(syncEntries,
+                                 [&dataSyncCfg, &path](const auto& e) {
+            return e._cfg == &dataSyncCfg && e._path == path;
+        }))
+        {
+            syncEntries.emplace_back(&dataSyncCfg, path);
+        }
+    };
+
+    entries.reserve(entries.size() + dataOperations.size());
+    for (const auto& dataOperation : dataOperations)
+    {
+        if (dataOperation._dataOp == watch::DataOps::MOVE)
+        {
+            // The new path is synced using the old path as the basis, and
+            // the old path is deleted along with the other modified paths.
+            addEntry(movedEntries, dataOperation._path);
+            addEntry(entries, dataOperation._movedFromPath);
+            continue;
+        }
+        addEntry(entries, dataOperation._path);
+    }
+}
+
+void Manager::createWatcherBackend()
+{
+    if (std::string_view{WATCHER_BACKEND} == "fanotify")
+    {
+        try
+        {
+            _watcherBackend =
+                std::make_unique<watch::fanotify::FanotifyWatcher>(_ctx);
+            lg2::info("Using the fanotify watcher backend for immediate sync");
+            return;
+        }
+        catch (const std::exception& e)
+        {
+            lg2::warning("The fanotify watcher backend is not supported, "
+                         "falling back to inotify. Exception : {ERROR}",
+                         "ERROR", e.what());
+        }
+    }
+
+    try
+    {
+        _watcherBackend =
+            std::make_unique<watch::inotify::InotifyWatcher>(_ctx);
+    }
+    catch (const std::exception& e)
+    {
+        // The immediate sync falls back to a watcher per configuration.
+        lg2::error("Failed to create the inotify watcher backend. Exception : "
+                   "{ERROR}",
+                   "ERROR", e.what());
+    }
+}
+
+bool Manager::subscribeDataChanges(const config::DataSyncConfig& dataSyncCfg)
+{
+    if (!_watcherBackend)
+    {
+        return false;
+    }
+
+    if (std::ranges::contains(_subscribers | std::views::values, &dataSyncCfg))
+    {
+        return true;
+    }
+
+    try
+    {
+        auto subscriberId = _watcherBackend->subscribe(
+            getEventMasksToWatch(dataSyncCfg), dataSyncCfg._path,
+            dataSyncCfg._excludeMatcher, dataSyncCfg._includeMatcher);
+        _subscribers.emplace(subscriberId, &dataSyncCfg);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        lg2::warning("Failed to subscribe {PATH} in the watcher backend, "
+                     "falling back to a dedicated watcher. Exception : "
+                     "{ERROR}",
+                     "PATH", dataSyncCfg._path, "ERROR", e.what());
+    }
+    return false;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::monitorDataChanges()
+{
+    _dataChangesMonitored = true;
+
+    // Ensure unsubscribing on scope exit so that the subscriptions are added
+    // again once the sync events are restarted.
+    auto cleanup = std::experimental::scope_exit([this]() {
+        for (const auto& subscriberId : _subscribers | std::views::keys)
+        {
+            _watcherBackend->unsubscribe(subscriberId);
+        }
+        _subscribers.clear();
+        _dataChangesMonitored = false;
+    });
+
+    while (!_ctx.stop_requested() && !_syncBMCDataIface.disable_sync() &&
+           !_subscribers.empty())
+    {
+        // NOLINTNEXTLINE
+        auto dataChanges = co_await _watcherBackend->onDataChange();
+
+        // Sync all the operations of this wakeup across the configurations
+        // as one batch
+        std::vector<SyncEntry> entries;
+        std::vector<SyncEntry> movedEntries;
+        bool queueOverflowed{false};
+        for (const auto& [subscriberId, dataOperations] : dataChanges)
+        {
+            if (auto subscriber = _subscribers.find(subscriberId);
+                subscriber != _subscribers.end())
+            {
+                processDataOperations(*subscriber->second, dataOperations,
+                                      entries, movedEntries);
+                queueOverflowed |= watch::isResyncRequired(dataOperations);
+            }
+        }
+
+        if (!entries.empty() || !movedEntries.empty())
+        {
+            // NOLINTNEXTLINE
+            _ctx.spawn(syncDataChanges(std::move(entries),
+                                       std::move(movedEntries)) |
+                       stdexec::then([]([[maybe_unused]] bool result) {}));
+        }
+
+        if (queueOverflowed)
+        {
+            ++_queueOverflowCount;
+            recreateWatcherBackend();
+        }
+    }
+    co_return;
+}
+
+void Manager::recreateWatcherBackend()
+{
+    // The subscriptions are released along with the old backend.
+    std::vector<const config::DataSyncConfig*> subscribedCfgs;
+    std::ranges::copy(_subscribers | std::views::values,
+                      std::back_inserter(subscribedCfgs));
+    _subscribers.clear();
+    _watcherBackend.reset();
+
+    createWatcherBackend();
+
+    std::ranges::for_each(subscribedCfgs, [this](const auto* dataSyncCfg) {
+        if (!subscribeDataChanges(*dataSyncCfg))
+        {
+            // NOLINTNEXTLINE
+            _ctx.spawn(monitorDataToSync(*dataSyncCfg));
+        }
+    });
+
+    lg2::info("Recreated the watcher backend for {COUNT} configured paths",
+              "COUNT", _subscribers.size());
+}
+
+void Manager::scheduleDebouncedSync(const config::DataSyncConfig& dataSyncCfg,
+                                    const fs::path& path)
+{
+    auto& pendingSync = dataSyncCfg._pendingSync;
+    auto now = std::chrono::steady_clock::now();
+
+    pendingSync._dirtyPaths.emplace(path);
+    pendingSync._lastChangeTime = now;
+
+    if (!pendingSync._flushScheduled)
+    {
+        pendingSync._firstChangeTime = now;
+        pendingSync._flushScheduled = true;
+        // NOLINTNEXTLINE
+        _ctx.spawn(flushDebouncedSyncs(dataSyncCfg));
+    }
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::flushDebouncedSyncs(const config::DataSyncConfig& dataSyncCfg)
+{
+    auto& pendingSync = dataSyncCfg._pendingSync;
+    const auto& debounce = dataSyncCfg._debounce.value();
+
+    // Wait until there is no change within the settle window, but not beyond
+    // the max latency from the first change so that a steady trickle of
+    // changes can't starve the sync.
+    while (!_ctx.stop_requested())
+    {
+        auto deadline =
+            std::min(pendingSync._lastChangeTime + debounce._settleWindow,
+                     pendingSync._firstChangeTime + debounce._maxLatency);
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            break;
+        }
+        co_await sdbusplus::async::sleep_for(
+            _ctx, std::chrono::duration_cast<std::chrono::milliseconds>(
+                      deadline - now));
+    }
+
+    auto dirtyPaths = std::exchange(pendingSync._dirtyPaths, {});
+    pendingSync._flushScheduled = false;
+
+    if (_ctx.stop_requested())
+    {
+        co_return;
+    }
+
+    lg2::debug("Debounce window closed for [{PATH}], syncing {COUNT} "
+               "modified path(s)",
+               "PATH", dataSyncCfg._path, "COUNT", dirtyPaths.size());
+
+    // The dirty paths are ordered, so the paths inside a modified directory
+    // follow the directory and can be skipped as the directory sync covers
+    // them.
+    std::vector<SyncEntry> entries;
+    std::optional<fs::path> lastSyncedDir;
+    for (const auto& path : dirtyPaths)
+    {
+        if (lastSyncedDir.has_value() &&
+            std::ranges::mismatch(*lastSyncedDir, path).in1 ==
+                lastSyncedDir->end())
+        {
+            continue;
+        }
+        lastSyncedDir = path.has_filename() ? path : path.parent_path();
+        entries.emplace_back(&dataSyncCfg, path);
+    }
+
+    // NOLINTNEXTLINE
+    co_await syncBatch(std::move(entries));
+    co_return;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> Manager::monitorPeriodicSyncs()
+{
+    using std::chrono::steady_clock;
+
+    _periodicSyncsMonitored = true;
+    auto cleanup = std::experimental::scope_exit(
+        [this]() { _periodicSyncsMonitored = false; });
+
+    auto schedule = std::make_shared<PeriodicSchedule>();
+    std::mt19937 randomEngine{std::random_device{}()};
+    const auto startTime = steady_clock::now();
+    for (const auto& dataSyncCfg : _dataSyncConfiguration)
+    {
+        if (dataSyncCfg._syncType != config::SyncType::Periodic ||
+            !dataSyncCfg._periodicityInSec.has_value() ||
+            !isSyncEligible(dataSyncCfg))
+        {
+            continue;
+        }
+
+        // Spread the first ticks so that the syncs of all the configurations
+        // don't start at once.
+        const auto interval = dataSyncCfg._periodicityInSec.value();
+        std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(
+            0, std::chrono::duration_cast<std::chrono::milliseconds>(interval)
+                       .count() *
+                   PERIODIC_SYNC_JITTER / 100);
+        schedule->_deadlines.emplace(
+            startTime + interval +
+                std::chrono::milliseconds{jitter(randomEngine)},
+            schedule->_syncs.size());
+        schedule->_syncs.emplace_back(&dataSyncCfg, interval);
+    }
+
+    auto& deadlines = schedule->_deadlines;
+    while (!deadlines.empty() && !_ctx.stop_requested() &&
+           !_syncBMCDataIface.disable_sync())
+    {
+        if (auto now = steady_clock::now(); deadlines.begin()->first > now)
+        {
+            // NOLINTNEXTLINE
+            co_await sdbusplus::async::sleep_for(
+                _ctx, std::chrono::duration_cast<std::chrono::milliseconds>(
+                          deadlines.begin()->first - now));
+            if (_ctx.stop_requested() || _syncBMCDataIface.disable_sync())
+            {
+                break;
+            }
+        }
+
+        // Fire all the configurations whose ticks are due within the
+        // tolerance, which is a tenth of their interval.
+        const auto now = steady_clock::now();
+        std::vector<size_t> firedSyncs;
+        for (auto deadline = deadlines.begin(); deadline != deadlines.end();)
+        {
+            auto& periodicSync = schedule->_syncs[deadline->second];
+            if (deadline->first > now + periodicSync._interval / 10)
+            {
+                ++deadline;
+                continue;
+            }
+            const auto index = deadline->second;
+            deadline = deadlines.erase(deadline);
+
+            const auto& dataSyncCfg = *periodicSync._cfg;
+            if (periodicSync._inProgress)
+            {
+                lg2::debug("Skipping the periodic sync of [{PATH}] as the "
+                           "previous sync is in progress",
+                           "PATH", dataSyncCfg._path);
+
+                // The configurations fired together keep ticking together.
+                deadlines.emplace(now + periodicSync._interval, index);
+                continue;
+            }
+
+            // The next tick is at the base interval so that a change found
+            // by the digest walk is synced in time, the walk backs it off if
+            // the data is not changed.
+            periodicSync._inProgress = true;
+            firedSyncs.emplace_back(index);
+            deadlines.emplace(now + dataSyncCfg._periodicityInSec.value(),
+                              index);
+        }
+
+        if (!firedSyncs.empty())
+        {
+            // NOLINTNEXTLINE
+            _ctx.spawn(syncPeriodicBatch(schedule, std::move(firedSyncs), now));
+        }
+    }
+    co_return;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::syncPeriodicBatch(std::shared_ptr<PeriodicSchedule> schedule,
+                               std::vector<size_t> indices,
+                               std::chrono::steady_clock::time_point firedAt)
+{
+    // Digest the data here rather than in the timer wheel, so that walking
+    // a large tree doesn't delay the ticks of the other configurations.
+    std::vector<size_t> changedIndices;
+    for (const auto index : indices)
+    {
+        auto& periodicSync = schedule->_syncs[index];
+        const auto& dataSyncCfg = *periodicSync._cfg;
+
+        // NOLINTNEXTLINE
+        auto digests = co_await getChangeDigests(dataSyncCfg);
+        if (!digests.has_value() || digests != periodicSync._syncedDigests)
+        {
+            // Digest before the sync so that the changes made meanwhile are
+            // synced in the next tick.
+            periodicSync._interval = dataSyncCfg._periodicityInSec.value();
+            periodicSync._pendingDigests = std::move(digests);
+            changedIndices.emplace_back(index);
+            continue;
+        }
+
+        periodicSync._inProgress = false;
+        periodicSync._interval = std::min(
+            periodicSync._interval * 2,
+            dataSyncCfg._maxPeriodicityInSec.value_or(
+                dataSyncCfg._periodicityInSec.value()));
+        lg2::debug("Skipping the periodic sync of [{PATH}] as not changed, "
+                   "next tick in [{INTERVAL}] seconds",
+                   "PATH", dataSyncCfg._path, "INTERVAL",
+                   periodicSync._interval.count());
+
+        // Back off the next tick, which the timer wheel scheduled at the
+        // base interval.
+        auto& deadlines = schedule->_deadlines;
+        if (auto deadline = std::ranges::find_if(
+                deadlines,
+                [index](const auto& entry) { return entry.second == index; });
+            deadline != deadlines.end())
+        {
+            deadlines.erase(deadline);
+        }
+        deadlines.emplace(firedAt + periodicSync._interval, index);
+    }
+    indices = std::move(changedIndices);
+
+    // The configurations with the include list sync only the existing
+    // include paths, hence those are not batched.
+    std::vector<SyncEntry> entries;
+    std::vector<size_t> batchedIndices;
+    std::map<size_t, bool> results;
+    for (const auto index : indices)
+    {
+        const auto* dataSyncCfg = schedule->_syncs[index]._cfg;
+        if (!dataSyncCfg->_includeList.has_value())
+        {
+            entries.emplace_back(dataSyncCfg, dataSyncCfg->_path);
+            batchedIndices.emplace_back(index);
+        }
+    }
+
+    if (!entries.empty())
+    {
+        // NOLINTNEXTLINE
+        const bool result = co_await syncBatch(std::move(entries),
+                                               async::SyncPriority::Periodic);
+        for (const auto index : batchedIndices)
+        {
+            results[index] = result;
+        }
+    }
+
+    for (const auto index : indices)
+    {
+        if (!results.contains(index))
+        {
+            // NOLINTNEXTLINE
+            results[index] = co_await syncData(*schedule->_syncs[index]._cfg,
+                                               fs::path{}, RsyncMode::Sync,
+                                               async::SyncPriority::Periodic);
+        }
+    }
+
+    for (const auto& [index, result] : results)
+    {
+        auto& periodicSync = schedule->_syncs[index];
+        periodicSync._inProgress = false;
+        if (result)
+        {
+            periodicSync._syncedDigests =
+                std::exchange(periodicSync._pendingDigests, std::nullopt);
+        }
+        else
+        {
+            periodicSync._syncedDigests.reset();
+            periodicSync._pendingDigests.reset();
+        }
+    }
+    co_return;
+}
+
+sdbusplus::async::task<std::optional<std::vector<digest::Digest>>>
+    // NOLINTNEXTLINE
+    Manager::getChangeDigests(const config::DataSyncConfig& dataSyncCfg)
+{
+    std::vector<fs::path> paths{dataSyncCfg._path};
+    if (dataSyncCfg._includeList.has_value())
+    {
+        paths.assign(dataSyncCfg._includeList->begin(),
+                     dataSyncCfg._includeList->end());
+        std::ranges::sort(paths);
+    }
+
+    std::vector<digest::Digest> digests;
+    for (const auto& path : paths)
+    {
+        std::optional<digest::Digest> treeDigest;
+        std::error_code ec;
+        if (fs::is_directory(fs::symlink_status(path, ec)))
+        {
+            digest::TreeDigester digester(path, dataSyncCfg._excludeMatcher);
+            // NOLINTNEXTLINE
+            co_await walkDigester(digester);
+
+            treeDigest = digester.getTreeDigest();
+            if (!treeDigest.has_value())
+            {
+                co_return std::nullopt;
+            }
+        }
+        digests.emplace_back(digest::getPathDigest(path, treeDigest));
+    }
+    co_return digests;
+}
+
+void Manager::disableSyncPropChanged(bool disableSync)
+{
+    if (disableSync)
+    {
+        // TODO: Disable all sync events using Sender Receiver.
+        lg2::info("Sync is Disabled, Stopping events");
+
+        // The changes are not tracked while the sync is disabled, hence the
+        // next startup needs a full sync, and from scratch since the entries
+        // completed by an interrupted full sync might be changed meanwhile.
+        _syncJournal.discard();
+        _fullSyncCheckpoint.clear();
+    }
+    else
+    {
+        lg2::info("Sync is Enabled, Starting events");
+        _ctx.spawn(startSyncEvents());
+    }
+}
+
+void Manager::setFullSyncStatus(const FullSyncStatus& fullSyncStatus)
+{
+    if (_syncBMCDataIface.full_sync_status() == fullSyncStatus)
+    {
+        return;
+    }
+    _syncBMCDataIface.full_sync_status(fullSyncStatus);
+
+    // Don't persist InProgress status as it's a transient state
+    if (fullSyncStatus == FullSyncStatus::FullSyncInProgress)
+    {
+        return;
+    }
+
+    try
+    {
+        data_sync::persist::update(data_sync::persist::key::fullSyncStatus,
+                                   fullSyncStatus);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error(
+            "Error writing fullSyncStatus property to JSON file: {ERROR}",
+            "ERROR", e);
+    }
+}
+
+void Manager::setSyncEventsHealth(const SyncEventsHealth& syncEventsHealth)
+{
+    if (_syncBMCDataIface.sync_events_health() == syncEventsHealth)
+    {
+        return;
+    }
+    _syncBMCDataIface.sync_events_health(syncEventsHealth);
+    try
+    {
+        data_sync::persist::update(data_sync::persist::key::syncEventsHealth,
+                                   syncEventsHealth);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error(
+            "Error writing syncEventsHealth property to JSON file: {ERROR}",
+            "ERROR", e);
+    }
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::runFullSyncWorker(std::shared_ptr<FullSyncQueue> queue)
+{
+    while (queue->_next < queue->_cfgs.size())
+    {
+        const auto index = queue->_next++;
+        const auto& cfg = *queue->_cfgs[index];
+        auto& cfgResult = queue->_results[index];
+
+        const auto cfgStartTime = std::chrono::steady_clock::now();
+        if (_fullSyncCheckpoint.isCompleted(cfg._path.string()))
+        {
+            lg2::debug("Full sync of [{PATH}] is already completed, skipping",
+                       "PATH", cfg._path);
+            cfgResult._success = true;
+            cfgResult._exitCode = 0;
+        }
+        else
+        {
+            // NOLINTNEXTLINE
+            auto changedSubtrees = co_await getChangedSubtrees(*queue, index);
+            if (changedSubtrees.has_value() ||
+                cfg._fullSyncShards.has_value())
+            {
+                // NOLINTNEXTLINE
+                cfgResult._success = co_await runShardedFullSync(
+                    cfg, cfgResult, std::move(changedSubtrees));
+            }
+            else
+            {
+                // NOLINTNEXTLINE
+                cfgResult._success = co_await syncData(
+                    cfg, fs::path{}, RsyncMode::Sync,
+                    async::SyncPriority::FullSync, &cfgResult);
+            }
+        }
+        if (cfgResult._success)
+        {
+            _fullSyncCheckpoint.markCompleted(cfg._path.string());
+        }
+        cfgResult._duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - cfgStartTime);
+
+        lg2::debug("Full sync of [{PATH}] : success : {SUCCESS}, exit code : "
+                   "{EXIT_CODE}, transferred bytes : {BYTES}, elapsed time : "
+                   "[{DURATION_MS}] ms",
+                   "PATH", cfgResult._path, "SUCCESS", cfgResult._success,
+                   "EXIT_CODE", cfgResult._exitCode, "BYTES",
+                   cfgResult._transferredBytes, "DURATION_MS",
+                   cfgResult._duration.count());
+
+        updateFullSyncProgress(*queue, index);
+
+        if (--queue->_pendingPerTier[cfg._criticality] == 0)
+        {
+            auto tierResults =
+                std::views::iota(size_t{0}, queue->_cfgs.size()) |
+                std::views::filter([&queue, &cfg](auto i) {
+                return queue->_cfgs[i]->_criticality == cfg._criticality;
+            });
+            const bool tierSynced =
+                std::ranges::all_of(tierResults, [&queue](auto i) {
+                return queue->_results[i]._success;
+            });
+            lg2::info("Full sync of the {CRITICALITY} criticality tier "
+                      "{STATUS}. Elapsed time : [{DURATION_MS}] ms",
+                      "CRITICALITY", cfg.getCriticalityInStr(), "STATUS",
+                      tierSynced ? "completed" : "failed", "DURATION_MS",
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - queue->_startTime)
+                          .count());
+        }
+    }
+    co_return;
+}
+
+void Manager::updateFullSyncProgress(FullSyncQueue& queue, size_t index)
+{
+    using namespace std::chrono_literals;
+    constexpr auto progressReportInterval = 5s;
+
+    const auto& cfgResult = queue._results[index];
+    ++queue._completedCount;
+    queue._transferredBytes += cfgResult._transferredBytes;
+    if (queue._estimatedSizes[index] != 0)
+    {
+        queue._processedBytes += queue._estimatedSizes[index];
+    }
+    else
+    {
+        // Include the actual size since it isn't part of the estimate.
+        queue._processedBytes += cfgResult._totalFileSize;
+        queue._estimatedBytes += cfgResult._totalFileSize;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (queue._completedCount != queue._cfgs.size() &&
+        now - queue._lastProgressReport < progressReportInterval)
+    {
+        return;
+    }
+    queue._lastProgressReport = now;
+
+    const auto progress = getFullSyncProgress();
+    lg2::info("Full sync progress : {COMPLETED}/{TOTAL} configurations, "
+              "{PROCESSED}/{ESTIMATED} bytes, transferred : {TRANSFERRED} "
+              "bytes, remaining time : [{REMAINING_SECONDS}] seconds",
+              "COMPLETED", progress._completedCfgs, "TOTAL",
+              progress._totalCfgs, "PROCESSED", progress._processedBytes,
+              "ESTIMATED", progress._estimatedBytes, "TRANSFERRED",
+              progress._transferredBytes, "REMAINING_SECONDS",
+              progress._remainingTime.count());
+}
+
+FullSyncProgress Manager::getFullSyncProgress() const
+{
+    FullSyncProgress progress;
+    if (!_fullSyncQueue)
+    {
+        return progress;
+    }
+
+    const auto& queue = *_fullSyncQueue;
+    progress._completedCfgs = queue._completedCount;
+    progress._totalCfgs = queue._cfgs.size();
+    progress._transferredBytes = queue._transferredBytes;
+    progress._processedBytes = queue._processedBytes;
+    progress._estimatedBytes = queue._estimatedBytes;
+
+    // The last report is upon the completion of the full sync.
+    const auto elapsedTime = (queue._completedCount == queue._cfgs.size()
+                                  ? queue._lastProgressReport
+                                  : std::chrono::steady_clock::now()) -
+                             queue._startTime;
+    progress._elapsedTime =
+        std::chrono::duration_cast<std::chrono::seconds>(elapsedTime);
+
+    // Estimate by the sizes if known, otherwise by the number of the
+    // configurations.
+    auto [done, total] = queue._estimatedBytes != 0
+                             ? std::pair{queue._processedBytes,
+                                         queue._estimatedBytes}
+                             : std::pair{queue._completedCount,
+                                         queue._cfgs.size()};
+    if (done != 0 && done < total)
+    {
+        progress._remainingTime =
+            std::chrono::duration_cast<std::chrono::seconds>(
+                elapsedTime * static_cast<double>(total - done) /
+                static_cast<double>(done));
+    }
+    return progress;
+}
+
+sdbusplus::async::task<std::vector<SyncEstimate>>
+    // NOLINTNEXTLINE
+    Manager::estimateFullSync()
+{
+    // Shared with the spawned dry-runs so that those don't refer to this
+    // frame.
+    auto estimates = std::make_shared<std::vector<SyncEstimate>>();
+    std::vector<const config::DataSyncConfig*> cfgs;
+    for (const auto& cfg : _dataSyncConfiguration)
+    {
+        if (isSyncEligible(cfg))
+        {
+            cfgs.emplace_back(&cfg);
+            estimates->emplace_back()._path = cfg._path;
+        }
+    }
+
+    // The concurrency is limited by the sync slots.
+    auto latch = std::make_shared<async::CompletionLatch>(_ctx);
+    for (size_t index = 0; index < cfgs.size(); ++index)
+    {
+        latch->add();
+        try
+        {
+            _ctx.spawn(estimateSync(*cfgs[index], (*estimates)[index]) |
+                       stdexec::then([latch, estimates]() { latch->done(); }));
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error("Full sync estimate spawn failed for [{PATH}], Error : "
+                       "{EXCEPTION}",
+                       "PATH", cfgs[index]->_path, "EXCEPTION", e);
+            latch->done();
+        }
+    }
+
+    // NOLINTNEXTLINE
+    co_await latch->wait();
+
+    co_return *estimates;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::estimateSync(const config::DataSyncConfig& dataSyncCfg,
+                          SyncEstimate& syncEstimate)
+{
+    const auto dryRunJob = getRsyncJob(RsyncMode::DryRunSync, dataSyncCfg, {});
+    if (!dryRunJob.hasSources())
+    {
+        // None of the configured paths exist, hence nothing to transfer.
+        syncEstimate._success = true;
+        syncEstimate._exitCode = 0;
+        co_return;
+    }
+
+    lg2::debug("Rsync dry-run command: {CMD}", "CMD", dryRunJob.toString());
+
+    std::pair<int, std::string> result{-1, ""};
+    {
+        // NOLINTNEXTLINE
+        auto slot = co_await _syncScheduler.acquire(
+            async::SyncPriority::FullSync, dataSyncCfg._path);
+        data_sync::async::AsyncCommandExecutor executor(_ctx);
+        // NOLINTNEXTLINE
+        result = co_await executor.execCmd(dryRunJob.getArgv());
+    }
+
+    syncEstimate._exitCode = result.first;
+    // The vanished source files don't affect the estimate of the rest.
+    syncEstimate._success = result.first == 0 || result.first == 24;
+    syncEstimate._files =
+        utility::rsync::getTransferredFilesCount(result.second);
+    syncEstimate._bytes =
+        utility::rsync::getTransferredFileSizeBytes(result.second);
+
+    if (!syncEstimate._success)
+    {
+        lg2::error("Failed to estimate the full sync of [{PATH}], ErrCode: "
+                   "{ERRCODE}, ErrMsg: {ERRMSG}",
+                   "PATH", dataSyncCfg._path, "ERRCODE", result.first,
+                   "ERRMSG", result.second);
+    }
+    co_return;
+}
+
+bool Manager::isDigestEligible(const config::DataSyncConfig& dataSyncCfg)
+{
+    return dataSyncCfg._isPathDir && !dataSyncCfg._includeList.has_value() &&
+           dataSyncCfg._syncDirection == config::SyncDirection::Active2Passive;
+}
+
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::walkDigester(digest::TreeDigester& digester)
+{
+    // The number of directories digested before yielding to the context
+    constexpr size_t digestSliceSize = 256;
+
+    digester.walk(digestSliceSize);
+    while (!digester.done())
+    {
+        // Yield to let the other coroutines run
+        // NOLINTNEXTLINE
+        co_await sdbusplus::async::sleep_for(_ctx,
+                                             std::chrono::milliseconds(0));
+        digester.walk(digestSliceSize);
+    }
+    co_return;
+}
+
+sdbusplus::async::task<std::optional<std::set<std::string>>>
     // NOLINTNEXTLINE
-    Manager::monitorDataToSync(const config::DataSyncConfig& dataSyncCfg)
+    Manager::getChangedSubtrees(FullSyncQueue& queue, size_t index)
 {
-    bool exception{false};
-    try
+    const auto& cfg = *queue._cfgs[index];
+    if (!isDigestEligible(cfg))
+    {
+        co_return std::nullopt;
+    }
+
+    // Digest before the sync so that the changes made meanwhile are synced
+    // again in the next full sync.
+    digest::TreeDigester digester(cfg._path, cfg._excludeMatcher);
+    // NOLINTNEXTLINE
+    co_await walkDigester(digester);
+
+    auto& digests = queue._digests[index];
+    digests = digester.getSubtreeDigests();
+    auto siblingDigests = queue._siblingDigests.find(cfg._path.string());
+    if (!digests.has_value() || siblingDigests == queue._siblingDigests.end())
+    {
+        co_return std::nullopt;
+    }
+
+    // The removed subdirectories change the top level digest.
+    std::set<std::string> changedSubtrees;
+    for (const auto& [subtree, subtreeDigest] : *digests)
     {
-        uint32_t eventMasksToWatch = IN_CLOSE_WRITE | IN_MOVE | IN_DELETE_SELF;
-        if (dataSyncCfg._isPathDir)
+        auto siblingDigest = siblingDigests->second.find(subtree);
+        if (siblingDigest == siblingDigests->second.end() ||
+            siblingDigest->second != subtreeDigest)
         {
-            eventMasksToWatch |= IN_CREATE | IN_DELETE;
+            changedSubtrees.emplace(subtree);
         }
+    }
 
-        auto excludeList =
-            dataSyncCfg._excludeList.has_value()
-                ? std::make_optional<std::unordered_set<fs::path>>(
-                      dataSyncCfg._excludeList.value().first)
-                : std::nullopt;
+    lg2::debug("Full sync of [{PATH}] : {CHANGED} of {TOTAL} subtrees are "
+               "changed since the previous full sync",
+               "PATH", cfg._path, "CHANGED", changedSubtrees.size(), "TOTAL",
+               digests->size());
+    co_return changedSubtrees;
+}
 
-        auto [it, inserted] = _activeWatchers.emplace(
-            dataSyncCfg._path,
-            std::make_unique<watch::inotify::DataWatcher>(
-                _ctx, IN_NONBLOCK | IN_CLOEXEC, eventMasksToWatch,
-                dataSyncCfg._path, excludeList, dataSyncCfg._includeList));
+sdbusplus::async::task<std::map<std::string, digest::SubtreeDigests>>
+    // NOLINTNEXTLINE
+    Manager::fetchSiblingDigests()
+{
+    std::map<std::string, digest::SubtreeDigests> siblingDigests;
 
-        auto* dataWatcher = it->second.get();
+    if (_syncBMCDataIface.sync_events_health() != SyncEventsHealth::Ok)
+    {
+        lg2::debug("Not using the sibling digests since the sync events "
+                   "health is not Ok");
+        co_return siblingDigests;
+    }
 
-        // Ensure removal on scope exit
-        auto cleanup = std::experimental::scope_exit([this, &dataSyncCfg]() {
-            _activeWatchers.erase(dataSyncCfg._path);
-        });
+    // All the subtrees are synced rather than waiting for rsync which can't
+    // connect.
+    if (!_siblingReachable)
+    {
+        lg2::debug("Not fetching the sibling digests since the sibling is "
+                   "unreachable");
+        co_return siblingDigests;
+    }
 
-        while (!_ctx.stop_requested() && !_syncBMCDataIface.disable_sync())
-        {
-            // NOLINTNEXTLINE
-            if (auto dataOperations = co_await dataWatcher->onDataChange();
-                !dataOperations.empty())
-            {
-                for (const auto& [path, dataOp] : dataOperations)
-                {
-                    // NOLINTNEXTLINE
-                    _ctx.spawn(
-                        syncData(dataSyncCfg, path) |
-                        stdexec::then([]([[maybe_unused]] bool result) {}));
-                }
-            }
-        }
+    std::error_code ec;
+    fs::remove(persist::SiblingDigestsFile, ec);
+
+    rsync::RsyncJob fetchJob({"--times"}, persist::SiblingDigestsFile.string());
+    fetchJob.addSource(getSiblingRsyncURL() +
+                       persist::ReceivedDigestsFile.string());
+    lg2::debug("Rsync command to fetch the sibling digests: {CMD}", "CMD",
+               fetchJob.toString());
+
+    std::pair<int, std::string> result{-1, ""};
+    {
+        // NOLINTNEXTLINE
+        auto slot = co_await _syncScheduler.acquire(
+            async::SyncPriority::FullSync, persist::SiblingDigestsFile);
+        data_sync::async::AsyncCommandExecutor executor(_ctx);
+        // NOLINTNEXTLINE
+        result = co_await executor.execCmd(fetchJob.getArgv());
     }
-    catch (std::exception& e)
+    if (result.first != 0)
     {
-        lg2::error("Failed to create watcher object for {PATH}. Exception : "
-                   "{ERROR}",
-                   "PATH", dataSyncCfg._path, "ERROR", e.what());
-        exception = true;
+        // The sibling doesn't have the digests if not synced before.
+        lg2::debug("Failed to fetch the sibling digests, ErrCode: {ERRCODE}, "
+                   "ErrMsg: {ERRMSG}",
+                   "ERRCODE", result.first, "ERRMSG", result.second);
+        co_return siblingDigests;
     }
-    if (exception)
+
+    try
     {
-        ext_data::AdditionalData additionalDetails = {
-            {"DS_Events_Path", dataSyncCfg._path.string()},
-            {"DS_Events_Msg",
-             "Exception: Failed to create inotify watcher for the configured path"}};
-        co_await _extDataIfaces->createErrorLog(
-            "xyz.openbmc_project.RBMC_DataSync.Error.SyncEventsFailure",
-            ext_data::ErrorLevel::Warning, additionalDetails);
+        siblingDigests =
+            persist::read<std::map<std::string, digest::SubtreeDigests>>(
+                persist::key::fullSyncDigests, persist::SiblingDigestsFile)
+                .value_or(std::map<std::string, digest::SubtreeDigests>{});
     }
-    co_return;
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to read the sibling digests: {ERROR}", "ERROR", e);
+    }
+    co_return siblingDigests;
 }
 
 sdbusplus::async::task<>
     // NOLINTNEXTLINE
-    Manager::monitorTimerToSync(const config::DataSyncConfig& dataSyncCfg)
+    Manager::sendSiblingDigests(
+        std::map<std::string, digest::SubtreeDigests> digests)
 {
-    while (!_ctx.stop_requested() && !_syncBMCDataIface.disable_sync() &&
-           dataSyncCfg._periodicityInSec.has_value())
+    // The next full sync syncs all the subtrees without the digests.
+    if (!_siblingReachable)
     {
-        co_await sdbusplus::async::sleep_for(
-            _ctx, dataSyncCfg._periodicityInSec.value());
-        // NOLINTNEXTLINE
-        co_await syncData(dataSyncCfg);
+        lg2::debug("Not sending the digests since the sibling is "
+                   "unreachable");
+        co_return;
     }
-    co_return;
-}
 
-void Manager::disableSyncPropChanged(bool disableSync)
-{
-    if (disableSync)
+    try
     {
-        // TODO: Disable all sync events using Sender Receiver.
-        lg2::info("Sync is Disabled, Stopping events");
+        persist::util::writeFile(
+            nlohmann::json{{persist::key::fullSyncDigests, digests}},
+            persist::SiblingDigestsFile);
     }
-    else
+    catch (const std::exception& e)
     {
-        lg2::info("Sync is Enabled, Starting events");
-        _ctx.spawn(startSyncEvents());
+        lg2::error("Failed to write the sibling digests: {ERROR}", "ERROR", e);
+        co_return;
+    }
+
+    rsync::RsyncJob sendJob(
+        {"--times"},
+        getSiblingRsyncURL() + persist::ReceivedDigestsFile.string());
+    sendJob.addSource(persist::SiblingDigestsFile);
+    lg2::debug("Rsync command to send the sibling digests: {CMD}", "CMD",
+               sendJob.toString());
+
+    std::pair<int, std::string> result{-1, ""};
+    {
+        // NOLINTNEXTLINE
+        auto slot = co_await _syncScheduler.acquire(
+            async::SyncPriority::FullSync, persist::SiblingDigestsFile);
+        data_sync::async::AsyncCommandExecutor executor(_ctx);
+        // NOLINTNEXTLINE
+        result = co_await executor.execCmd(sendJob.getArgv());
+    }
+    if (result.first != 0)
+    {
+        // The next full sync syncs all the subtrees.
+        lg2::error("Failed to send the digests to the sibling, ErrCode: "
+                   "{ERRCODE}, ErrMsg: {ERRMSG}",
+                   "ERRCODE", result.first, "ERRMSG", result.second);
     }
+    co_return;
 }
 
-void Manager::setFullSyncStatus(const FullSyncStatus& fullSyncStatus)
+sdbusplus::async::task<bool>
+    // NOLINTNEXTLINE
+    Manager::runShardedFullSync(
+        const config::DataSyncConfig& dataSyncCfg, SyncResult& syncResult,
+        std::optional<std::set<std::string>> changedSubtrees)
 {
-    if (_syncBMCDataIface.full_sync_status() == fullSyncStatus)
+    if (changedSubtrees.has_value() && changedSubtrees->empty())
     {
-        return;
+        lg2::debug("Full sync of [{PATH}] is skipped as the sibling has the "
+                   "same data",
+                   "PATH", dataSyncCfg._path);
+        syncResult._exitCode = 0;
+        co_return true;
     }
-    _syncBMCDataIface.full_sync_status(fullSyncStatus);
 
-    // Don't persist InProgress status as it's a transient state
-    if (fullSyncStatus == FullSyncStatus::FullSyncInProgress)
+    // Shared with the spawned shards so that those don't refer to this frame.
+    auto shards = std::make_shared<std::vector<std::vector<SyncEntry>>>(
+        dataSyncCfg._fullSyncShards.value_or(1));
+    size_t subDirCount{0};
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(dataSyncCfg._path, ec))
     {
-        return;
+        if (entry.is_symlink(ec) || !entry.is_directory(ec) ||
+            (dataSyncCfg._excludeMatcher.has_value() &&
+             dataSyncCfg._excludeMatcher->matches(entry.path(), true)) ||
+            (changedSubtrees.has_value() &&
+             !changedSubtrees->contains(entry.path().filename().string())))
+        {
+            continue;
+        }
+        // The completed shards are persisted by their index, hence the
+        // subdirectories have to fall into the same shards across the builds.
+        auto& shard =
+            (*shards)[utility::getStableHash(entry.path().filename().string()) %
+                      shards->size()];
+        shard.emplace_back(&dataSyncCfg, entry.path());
+        ++subDirCount;
     }
 
-    try
+    if (ec || (!changedSubtrees.has_value() && subDirCount < shards->size()))
     {
-        data_sync::persist::update(data_sync::persist::key::fullSyncStatus,
-                                   fullSyncStatus);
+        lg2::debug("Not sharding the full sync of [{PATH}] with {COUNT} "
+                   "subdirectories",
+                   "PATH", dataSyncCfg._path, "COUNT", subDirCount);
+        // NOLINTNEXTLINE
+        co_return co_await syncData(dataSyncCfg, fs::path{}, RsyncMode::Sync,
+                                    async::SyncPriority::FullSync,
+                                    &syncResult);
     }
-    catch (const std::exception& e)
+
+    lg2::debug("Full sync of [{PATH}] is split into {SHARDS} shards of "
+               "{COUNT} subdirectories",
+               "PATH", dataSyncCfg._path, "SHARDS", shards->size(), "COUNT",
+               subDirCount);
+
+    auto shardResults =
+        std::make_shared<std::vector<SyncResult>>(shards->size());
+    auto latch = std::make_shared<async::CompletionLatch>(_ctx);
+    for (size_t index = 0; index < shards->size(); ++index)
     {
-        lg2::error(
-            "Error writing fullSyncStatus property to JSON file: {ERROR}",
-            "ERROR", e);
+        auto& shardResult = (*shardResults)[index];
+        if ((*shards)[index].empty() ||
+            _fullSyncCheckpoint.isCompleted(
+                persist::FullSyncCheckpoint::getShardKey(
+                    dataSyncCfg._path, index, shards->size())))
+        {
+            shardResult._success = true;
+            shardResult._exitCode = 0;
+            continue;
+        }
+
+        latch->add();
+        try
+        {
+            _ctx.spawn(runBatchSync((*shards)[index],
+                                    async::SyncPriority::FullSync,
+                                    &shardResult) |
+                       stdexec::then([this, shards, shardResults, latch,
+                                      &shardResult,
+                                      shardKey = persist::FullSyncCheckpoint::
+                                          getShardKey(dataSyncCfg._path, index,
+                                                      shards->size())](
+                                         bool result) {
+                shardResult._success = result;
+                if (result)
+                {
+                    _fullSyncCheckpoint.markCompleted(shardKey);
+                }
+                latch->done();
+            }));
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error("Full sync shard spawn failed for [{PATH}], Error : "
+                       "{EXCEPTION}",
+                       "PATH", dataSyncCfg._path, "EXCEPTION", e);
+            latch->done();
+        }
     }
-}
 
-void Manager::setSyncEventsHealth(const SyncEventsHealth& syncEventsHealth)
-{
-    if (_syncBMCDataIface.sync_events_health() == syncEventsHealth)
+    // Sync the top level files and delete the removed subdirectories along
+    // with the shards.
+    // The top level is checkpointed as the shard next to the last one.
+    const auto rootKey = persist::FullSyncCheckpoint::getShardKey(
+        dataSyncCfg._path, shards->size(), shards->size());
+    SyncResult rootResult;
+    if (_fullSyncCheckpoint.isCompleted(rootKey) ||
+        (changedSubtrees.has_value() &&
+         !changedSubtrees->contains(digest::rootKey)))
     {
-        return;
+        rootResult._success = true;
+        rootResult._exitCode = 0;
     }
-    _syncBMCDataIface.sync_events_health(syncEventsHealth);
-    try
+    else
     {
-        data_sync::persist::update(data_sync::persist::key::syncEventsHealth,
-                                   syncEventsHealth);
+        // NOLINTNEXTLINE
+        rootResult._success = co_await runSync(
+            dataSyncCfg, fs::path{}, 0, RsyncMode::ShardRootSync,
+            async::SyncPriority::FullSync, &rootResult);
+        if (rootResult._success)
+        {
+            _fullSyncCheckpoint.markCompleted(rootKey);
+        }
     }
-    catch (const std::exception& e)
+    // NOLINTNEXTLINE
+    co_await latch->wait();
+
+    // Merge the results of the shards into the configuration result.
+    shardResults->emplace_back(std::move(rootResult));
+    bool result{true};
+    syncResult._exitCode = 0;
+    syncResult._totalFileSize = 0;
+    for (const auto& shardResult : *shardResults)
     {
-        lg2::error(
-            "Error writing syncEventsHealth property to JSON file: {ERROR}",
-            "ERROR", e);
+        result &= shardResult._success;
+        if (syncResult._exitCode == 0)
+        {
+            syncResult._exitCode = shardResult._exitCode;
+        }
+        syncResult._transferredBytes += shardResult._transferredBytes;
+        syncResult._totalFileSize += shardResult._totalFileSize;
     }
+    co_return result;
 }
 
 // NOLINTNEXTLINE
@@ -885,39 +2753,134 @@ sdbusplus::async::task<void> Manager::startFullSync()
 
     auto fullSyncStartTime = std::chrono::steady_clock::now();
 
-    auto syncResults = std::vector<bool>();
-    size_t spawnedTasks = 0;
+    // Resume the interrupted full sync of the same generation.
+    if (auto resumed = _fullSyncCheckpoint.load(getConfigurationId());
+        resumed != 0)
+    {
+        lg2::info("Resuming the full sync, {COUNT} entries already completed",
+                  "COUNT", resumed);
+    }
 
+    // Shared with the spawned workers so that those don't refer to this frame.
+    auto queue = std::make_shared<FullSyncQueue>();
+    queue->_startTime = fullSyncStartTime;
     for (const auto& cfg : _dataSyncConfiguration)
     {
-        // TODO: add receiver logic to stop fullsync when disable sync is set to
-        // true.
+        if (isSyncEligible(cfg))
+        {
+            queue->_cfgs.emplace_back(&cfg);
+            ++queue->_pendingPerTier[cfg._criticality];
+        }
+    }
+
+    // Sync the higher criticality tiers first, and the largest configurations
+    // first within a tier so that the tier completes as early as possible.
+    // The configurations without the size from the previous runs are
+    // considered as the largest.
+    std::map<std::string, size_t> cfgSizes;
+    try
+    {
+        cfgSizes = persist::read<std::map<std::string, size_t>>(
+                       persist::key::fullSyncSizes, persist::FullSyncStatsFile)
+                       .value_or(std::map<std::string, size_t>{});
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to read the full sync sizes: {ERROR}", "ERROR", e);
+    }
+    auto getEstimatedSize = [&cfgSizes](const config::DataSyncConfig* cfg) {
+        auto size = cfgSizes.find(cfg->_path.string());
+        return size != cfgSizes.end() ? size->second
+                                      : std::numeric_limits<size_t>::max();
+    };
+    std::ranges::stable_sort(
+        queue->_cfgs, [&getEstimatedSize](const auto* lhs, const auto* rhs) {
+        if (lhs->_criticality != rhs->_criticality)
+        {
+            return lhs->_criticality < rhs->_criticality;
+        }
+        return getEstimatedSize(lhs) > getEstimatedSize(rhs);
+    });
+
+    queue->_results.resize(queue->_cfgs.size());
+    for (size_t index = 0; index < queue->_cfgs.size(); ++index)
+    {
+        queue->_results[index]._path = queue->_cfgs[index]->_path;
+        auto size = cfgSizes.find(queue->_cfgs[index]->_path.string());
+        queue->_estimatedSizes.emplace_back(
+            size != cfgSizes.end() ? size->second : 0);
+        queue->_estimatedBytes += queue->_estimatedSizes.back();
+    }
+    queue->_lastProgressReport = fullSyncStartTime;
+    queue->_digests.resize(queue->_cfgs.size());
+    if (std::ranges::any_of(queue->_cfgs, [](const auto* cfg) {
+        return isDigestEligible(*cfg);
+    }))
+    {
+        // NOLINTNEXTLINE
+        queue->_siblingDigests = co_await fetchSiblingDigests();
+    }
+    _fullSyncQueue = queue;
+
+    // TODO: add receiver logic to stop fullsync when disable sync is set to
+    // true.
+    auto latch = std::make_shared<async::CompletionLatch>(_ctx);
+    const auto workers = std::min<size_t>(FULL_SYNC_WORKERS,
+                                          queue->_cfgs.size());
+    for (size_t worker = 0; worker < workers; ++worker)
+    {
+        latch->add();
         try
         {
-            if (isSyncEligible(cfg))
-            {
-                _ctx.spawn(
-                    syncData(cfg) |
-                    stdexec::then([&syncResults, &spawnedTasks](bool result) {
-                    syncResults.push_back(result);
-                    spawnedTasks--; // Decrement the number of spawned tasks
-                }));
-                spawnedTasks++;     // Increment the number of spawned tasks
-            }
+            _ctx.spawn(runFullSyncWorker(queue) |
+                       stdexec::then([latch]() { latch->done(); }));
         }
         catch (const std::exception& e)
         {
-            lg2::error(
-                "Full sync spawn failed for [{PATH}], Error : {EXCEPTION}",
-                "PATH", cfg._path, "EXCEPTION", e);
-            setFullSyncStatus(FullSyncStatus::FullSyncFailed);
+            lg2::error("Full sync worker spawn failed, Error : {EXCEPTION}",
+                       "EXCEPTION", e);
+            latch->done();
         }
     }
 
-    while (spawnedTasks > 0)
+    // NOLINTNEXTLINE
+    co_await latch->wait();
+
+    // The configurations which are not taken by any worker remain failed.
+    _fullSyncResults = std::move(queue->_results);
+
+    for (const auto& cfgResult : _fullSyncResults)
     {
-        co_await sdbusplus::async::sleep_for(_ctx,
-                                             std::chrono::milliseconds(50));
+        if (cfgResult._success && cfgResult._totalFileSize != 0)
+        {
+            cfgSizes[cfgResult._path.string()] = cfgResult._totalFileSize;
+        }
+    }
+    try
+    {
+        persist::update(persist::key::fullSyncSizes, cfgSizes,
+                        persist::FullSyncStatsFile);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Failed to write the full sync sizes: {ERROR}", "ERROR", e);
+    }
+
+    // The sibling has the digested data of the synced configurations.
+    std::map<std::string, digest::SubtreeDigests> syncedDigests;
+    for (size_t index = 0; index < queue->_cfgs.size(); ++index)
+    {
+        if (_fullSyncResults[index]._success &&
+            queue->_digests[index].has_value())
+        {
+            syncedDigests.emplace(queue->_cfgs[index]->_path.string(),
+                                  std::move(*queue->_digests[index]));
+        }
+    }
+    if (!syncedDigests.empty())
+    {
+        // NOLINTNEXTLINE
+        co_await sendSiblingDigests(std::move(syncedDigests));
     }
 
     auto fullSyncEndTime = std::chrono::steady_clock::now();
@@ -926,14 +2889,21 @@ sdbusplus::async::task<void> Manager::startFullSync()
 
     // If any sync operation fails, the FullSync will be considered failed;
     // otherwise, it will be marked as completed.
-    if (std::ranges::all_of(syncResults,
-                            [](const auto& result) { return result; }))
+    if (std::ranges::all_of(_fullSyncResults,
+                            [](const auto& result) { return result._success; }))
     {
         lg2::info(
             "Full Sync completed successfully. Elapsed time : [{DURATION_SECONDS}] seconds",
             "DURATION_SECONDS", FullsyncElapsedTime.count());
         setFullSyncStatus(FullSyncStatus::FullSyncCompleted);
         setSyncEventsHealth(SyncEventsHealth::Ok);
+        _fullSyncCheckpoint.clear();
+
+        // Track the changes from now on to avoid the full sync upon restart.
+        if (!_syncJournal.isOpen())
+        {
+            _syncJournal.create(getConfigurationId());
+        }
     }
     else
     {
@@ -956,19 +2926,59 @@ nlohmann::json Manager::collectAllWatchingPaths() const
 
     for (const auto& [configPath, dataWatcher] : _activeWatchers)
     {
-        const auto& wds = dataWatcher->getWatchDescriptors();
+        const auto watchedPaths = dataWatcher->getWatchingPaths();
 
         std::vector<std::string> paths;
-        paths.reserve(wds.size());
+        paths.reserve(watchedPaths.size());
 
-        std::ranges::transform(
-            wds, std::back_inserter(paths),
-            [](const auto& entry) { return entry.second.string(); });
+        std::ranges::transform(watchedPaths, std::back_inserter(paths),
+                               [](const auto& path) { return path.string(); });
 
         watchingPaths.emplace(configPath.string(), std::move(paths));
     }
 
+    for (const auto& [subscriberId, dataSyncCfg] : _subscribers)
+    {
+        std::vector<std::string> paths;
+        std::ranges::transform(
+            _watcherBackend->getWatchingPaths(subscriberId),
+            std::back_inserter(paths),
+            [](const auto& path) { return path.string(); });
+
+        watchingPaths.emplace(dataSyncCfg->_path.string(), std::move(paths));
+    }
+
     result["watching_paths"] = watchingPaths;
+    result["queue_overflows"] = _queueOverflowCount;
+
+    // The sync slots usage of each priority class to tune the concurrency.
+    nlohmann::json syncSlots;
+    syncSlots["max_concurrent_syncs"] = _syncScheduler.getMaxConcurrentSyncs();
+    for (auto priority :
+         {async::SyncPriority::Immediate, async::SyncPriority::Notify,
+          async::SyncPriority::Periodic, async::SyncPriority::FullSync})
+    {
+        const auto& stats = _syncScheduler.getStats(priority);
+        syncSlots[std::string{
+            async::SyncScheduler::getPriorityInStr(priority)}] = {
+            {"running", stats._running},
+            {"queued", stats._queued},
+            {"max_queued", stats._maxQueued},
+            {"granted", stats._granted},
+            {"total_wait_ms", stats._totalWaitTime.count()},
+            {"max_wait_ms", stats._maxWaitTime.count()}};
+    }
+    result["sync_slots"] = syncSlots;
+
+    const auto progress = getFullSyncProgress();
+    result["full_sync_progress"] = {
+        {"completed_configs", progress._completedCfgs},
+        {"total_configs", progress._totalCfgs},
+        {"transferred_bytes", progress._transferredBytes},
+        {"processed_bytes", progress._processedBytes},
+        {"estimated_bytes", progress._estimatedBytes},
+        {"elapsed_seconds", progress._elapsedTime.count()},
+        {"remaining_seconds", progress._remainingTime.count()}};
 
     // Add timestamp of collecting along with the list of watchers
     auto now = std::chrono::system_clock::now();
@@ -984,46 +2994,54 @@ void Manager::registerSignalHandler()
 {
     try
     {
-        // Block SIGUSR1 so it's delivered via signalfd instead of default
-        // handler
+        // Block SIGUSR1 and SIGUSR2 so those are delivered via signalfd
+        // instead of default handler
         sigset_t ss;
-        if (sigemptyset(&ss) < 0 || sigaddset(&ss, SIGUSR1) < 0)
+        if (sigemptyset(&ss) < 0 || sigaddset(&ss, SIGUSR1) < 0 ||
+            sigaddset(&ss, SIGUSR2) < 0)
         {
-            lg2::error("Failed to setup signal mask for SIGUSR1");
+            lg2::error("Failed to setup signal mask for SIGUSR1 and SIGUSR2");
             return;
         }
 
         if (pthread_sigmask(SIG_BLOCK, &ss, nullptr) != 0)
         {
-            lg2::error("Failed to block SIGUSR1 signal: {ERROR}", "ERROR",
-                       std::strerror(errno));
+            lg2::error("Failed to block SIGUSR1 and SIGUSR2 signals: {ERROR}",
+                       "ERROR", std::strerror(errno));
             return;
         }
 
-        utility::FD sigusr1Fd{signalfd(-1, &ss, SFD_NONBLOCK | SFD_CLOEXEC)};
-        if (sigusr1Fd() < 0)
+        utility::FD sigFd{signalfd(-1, &ss, SFD_NONBLOCK | SFD_CLOEXEC)};
+        if (sigFd() < 0)
         {
             lg2::error("Failed to create signalfd: {ERROR}", "ERROR",
                        std::strerror(errno));
             return;
         }
 
-        lg2::debug(
-            "Successfully registered SIGUSR1 handler using fdio (fd={FD})",
-            "FD", sigusr1Fd());
+        lg2::debug("Successfully registered SIGUSR1 and SIGUSR2 handler using "
+                   "fdio (fd={FD})",
+                   "FD", sigFd());
 
         // Move fd ownership into the coroutine — RAII closes it on exit
         _ctx.spawn([](sdbusplus::async::context& ctx, Manager* mgr,
-                      utility::FD sigusr1Fd) -> sdbusplus::async::task<> {
-            sdbusplus::async::fdio sigusr1Fdio(ctx, sigusr1Fd());
+                      utility::FD sigFd) -> sdbusplus::async::task<> {
+            sdbusplus::async::fdio sigFdio(ctx, sigFd());
             while (!ctx.stop_requested())
             {
-                co_await sigusr1Fdio.next();
+                co_await sigFdio.next();
 
                 signalfd_siginfo si{};
-                ssize_t s = read(sigusr1Fd(), &si, sizeof(si));
+                ssize_t s = read(sigFd(), &si, sizeof(si));
 
-                if (s == sizeof(si))
+                if (s == sizeof(si) && si.ssi_signo == SIGUSR2)
+                {
+                    lg2::info(
+                        "Received SIGUSR2 (signal {SIG}), estimating the full sync",
+                        "SIG", si.ssi_signo);
+                    ctx.spawn(mgr->dumpFullSyncEstimateToFile());
+                }
+                else if (s == sizeof(si))
                 {
                     lg2::info(
                         "Received SIGUSR1 (signal {SIG}), dumping all watching paths",
@@ -1036,11 +3054,12 @@ void Manager::registerSignalHandler()
                                std::strerror(errno));
                 }
             }
-        }(_ctx, this, std::move(sigusr1Fd)));
+        }(_ctx, this, std::move(sigFd)));
     }
     catch (const std::exception& e)
     {
-        lg2::error("Failed to register SIGUSR1 handler: {ERROR}", "ERROR", e);
+        lg2::error("Failed to register SIGUSR1 and SIGUSR2 handler: {ERROR}",
+                   "ERROR", e);
     }
 }
 
@@ -1076,4 +3095,74 @@ void Manager::dumpWatchingPathsToFile() const
     }
 }
 
+sdbusplus::async::task<>
+    // NOLINTNEXTLINE
+    Manager::dumpFullSyncEstimateToFile()
+{
+    constexpr auto outputFile = "/tmp/data_sync_full_sync_estimate.json";
+
+    if (_fullSyncEstimateInProgress)
+    {
+        lg2::info("Full sync estimate is already in progress, ignoring");
+        co_return;
+    }
+    _fullSyncEstimateInProgress = true;
+
+    // NOLINTNEXTLINE
+    auto estimates = co_await estimateFullSync();
+    _fullSyncEstimateInProgress = false;
+
+    nlohmann::json output;
+    output["full_sync_estimate"] = nlohmann::json::object();
+    size_t totalFiles{0};
+    size_t totalBytes{0};
+    for (const auto& estimate : estimates)
+    {
+        output["full_sync_estimate"][estimate._path.string()] = {
+            {"success", estimate._success},
+            {"exit_code", estimate._exitCode},
+            {"files", estimate._files},
+            {"bytes", estimate._bytes}};
+        totalFiles += estimate._files;
+        totalBytes += estimate._bytes;
+    }
+    output["total"] = {{"files", totalFiles}, {"bytes", totalBytes}};
+
+    auto now = std::chrono::system_clock::now();
+    auto timeT = std::chrono::system_clock::to_time_t(now);
+    std::stringstream ss;
+    ss << std::put_time(std::gmtime(&timeT), "%Y-%m-%dT%H:%M:%SZ");
+    output["timestamp"] = ss.str();
+
+    try
+    {
+        // Write to a temporary file and rename so that the reader never sees
+        // a partial estimate.
+        const fs::path tmpFile = std::string(outputFile) + ".tmp";
+        std::ofstream file(tmpFile);
+        if (!file.is_open())
+        {
+            lg2::error("Failed to open file for dumping full sync estimate: "
+                       "{FILE}",
+                       "FILE", tmpFile);
+            co_return;
+        }
+
+        file << output.dump(4);
+        file.close();
+        fs::rename(tmpFile, outputFile);
+
+        lg2::info("Dumped the full sync estimate to {FILE}, files : {FILES}, "
+                  "bytes : {BYTES}",
+                  "FILE", outputFile, "FILES", totalFiles, "BYTES",
+                  totalBytes);
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error("Error writing full sync estimate file: {ERROR}", "ERROR",
+                   e);
+    }
+    co_return;
+}
+
 } // namespace data_sync
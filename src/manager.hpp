@@ -5,18 +5,28 @@
 #include "data_sync_config.hpp"
 #include "data_watcher.hpp"
 #include "external_data_ifaces.hpp"
+#include "full_sync_checkpoint.hpp"
 #include "notify_service.hpp"
 #include "persistent.hpp"
+#include "retry_queue.hpp"
+#include "rsync_job.hpp"
+#include "sibling_monitor.hpp"
 #include "sync_bmc_data_ifaces.hpp"
+#include "sync_journal.hpp"
+#include "sync_scheduler.hpp"
+#include "tree_digest.hpp"
+#include "watcher.hpp"
 
 #include <sdbusplus/async.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <map>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <set>
 #include <vector>
 
 namespace data_sync
@@ -31,8 +41,260 @@ namespace fs = std::filesystem;
 
 enum class RsyncMode
 {
-    Sync,  // perform sync
-    Notify // perform sibling notification
+    Sync,          // perform sync
+    BatchSync,     // perform sync of the list of paths read from stdin
+    MoveSync,      // perform sync of the list of moved paths read from stdin
+                   // using the data of a similar path in the destination
+                   // directory as the basis
+    ShardRootSync, // perform sync of the top level of a sharded directory
+                   // without recursing into its subdirectories
+    DryRunSync,    // perform sync without any change to report what would
+                   // transfer
+    Notify         // perform sibling notification
+};
+
+/**
+ * @brief The modified path along with the data sync configuration which it
+ *        belongs to, to sync as part of a batch.
+ */
+struct SyncEntry
+{
+    /**
+     * @brief The data sync configuration of the modified path.
+     */
+    const config::DataSyncConfig* _cfg;
+
+    /**
+     * @brief The modified path inside the configured path.
+     */
+    fs::path _path;
+};
+
+/**
+ * @brief The outcome of the sync of a configured path.
+ */
+struct SyncResult
+{
+    /**
+     * @brief The configured path.
+     */
+    fs::path _path;
+
+    /**
+     * @brief Whether the path is synced.
+     */
+    bool _success{false};
+
+    /**
+     * @brief The exit code of the last rsync, -1 if rsync didn't run.
+     */
+    int _exitCode{-1};
+
+    /**
+     * @brief The number of the bytes transferred by all the rsync attempts.
+     */
+    size_t _transferredBytes{0};
+
+    /**
+     * @brief The total size of the synced files as per the last rsync, which
+     *        estimates the cost of the next full sync.
+     */
+    size_t _totalFileSize{0};
+
+    /**
+     * @brief The time taken to sync including the wait for a sync slot and
+     *        the retries.
+     */
+    std::chrono::milliseconds _duration{0};
+};
+
+/**
+ * @brief The configurations to sync as part of a full sync, shared by the
+ *        full sync workers.
+ */
+struct FullSyncQueue
+{
+    /**
+     * @brief The configurations in the order to sync.
+     */
+    std::vector<const config::DataSyncConfig*> _cfgs;
+
+    /**
+     * @brief The results of the configurations, in the same order.
+     */
+    std::vector<SyncResult> _results;
+
+    /**
+     * @brief The index of the next configuration to sync.
+     */
+    size_t _next{0};
+
+    /**
+     * @brief The number of the configurations yet to complete per
+     *        criticality tier.
+     */
+    std::map<config::Criticality, size_t> _pendingPerTier;
+
+    /**
+     * @brief The time at which the full sync started.
+     */
+    std::chrono::steady_clock::time_point _startTime;
+
+    /**
+     * @brief The sizes of the configurations from the previous full sync,
+     *        in the same order, 0 if not known.
+     */
+    std::vector<size_t> _estimatedSizes;
+
+    /**
+     * @brief The number of the configurations completed.
+     */
+    size_t _completedCount{0};
+
+    /**
+     * @brief The estimated size of all the configurations, which includes
+     *        the actual size of the completed configurations without the
+     *        estimate.
+     */
+    size_t _estimatedBytes{0};
+
+    /**
+     * @brief The estimated size of the completed configurations.
+     */
+    size_t _processedBytes{0};
+
+    /**
+     * @brief The number of the bytes transferred so far.
+     */
+    size_t _transferredBytes{0};
+
+    /**
+     * @brief The time at which the progress was last reported.
+     */
+    std::chrono::steady_clock::time_point _lastProgressReport;
+
+    /**
+     * @brief The digests of the subtrees which the sibling received by the
+     *        previous full sync, per configured path.
+     */
+    std::map<std::string, digest::SubtreeDigests> _siblingDigests;
+
+    /**
+     * @brief The digests of the subtrees of the configurations taken before
+     *        the sync, in the same order, std::nullopt if not taken.
+     */
+    std::vector<std::optional<digest::SubtreeDigests>> _digests;
+};
+
+/**
+ * @brief The state of a configuration which is synced periodically.
+ */
+struct PeriodicSync
+{
+    /**
+     * @brief The data sync configuration.
+     */
+    const config::DataSyncConfig* _cfg;
+
+    /**
+     * @brief The current interval, which is backed off while the data is
+     *        not changed.
+     */
+    std::chrono::seconds _interval;
+
+    /**
+     * @brief The digests of the data at the last successful sync.
+     */
+    std::optional<std::vector<digest::Digest>> _syncedDigests;
+
+    /**
+     * @brief The digests of the data taken before the in-progress sync.
+     */
+    std::optional<std::vector<digest::Digest>> _pendingDigests;
+
+    /**
+     * @brief Indicates whether the sync of the configuration is in progress.
+     */
+    bool _inProgress{false};
+};
+
+/**
+ * @brief The timer wheel of all the periodic syncs, shared by the periodic
+ *        sync jobs.
+ */
+struct PeriodicSchedule
+{
+    /**
+     * @brief The configurations which are synced periodically.
+     */
+    std::vector<PeriodicSync> _syncs;
+
+    /**
+     * @brief The next tick of the configurations, by their index in _syncs.
+     */
+    std::multimap<std::chrono::steady_clock::time_point, size_t> _deadlines;
+};
+
+/**
+ * @brief The estimate of the data which a full sync of a configured path
+ *        would transfer.
+ */
+struct SyncEstimate
+{
+    /**
+     * @brief The configured path.
+     */
+    fs::path _path;
+
+    /**
+     * @brief Whether the dry-run succeeded.
+     */
+    bool _success{false};
+
+    /**
+     * @brief The exit code of the dry-run, -1 if rsync didn't run.
+     */
+    int _exitCode{-1};
+
+    /**
+     * @brief The number of the regular files which would transfer.
+     */
+    size_t _files{0};
+
+    /**
+     * @brief The total size of the files which would transfer.
+     */
+    size_t _bytes{0};
+};
+
+/**
+ * @brief The progress of the full sync.
+ */
+struct FullSyncProgress
+{
+    /**
+     * @brief The number of the configurations completed and to sync.
+     */
+    size_t _completedCfgs{0};
+    size_t _totalCfgs{0};
+
+    /**
+     * @brief The number of the bytes transferred so far.
+     */
+    size_t _transferredBytes{0};
+
+    /**
+     * @brief The estimated size of the completed configurations and of all
+     *        the configurations.
+     */
+    size_t _processedBytes{0};
+    size_t _estimatedBytes{0};
+
+    /**
+     * @brief The elapsed time and the estimated remaining time.
+     */
+    std::chrono::seconds _elapsedTime{0};
+    std::chrono::seconds _remainingTime{0};
 };
 
 /**
@@ -90,13 +352,35 @@ class Manager
      *
      * @return True if sibling BMC is not available; otherwise False.
      */
-    static bool isSiblingBmcNotAvailable()
+    bool isSiblingBmcNotAvailable() const
+    {
+        return !_siblingReachable;
+    }
+
+    /**
+     * @brief API to handle the reachability change of the sibling BMC.
+     *
+     *        - The syncs are parked while the sibling is not reachable
+     *          instead of running rsync which can't connect.
+     *        - The parked syncs are drained as one batched catch-up sync
+     *          once the sibling is reachable again.
+     *
+     * @param[in] reachable - Whether the sibling BMC is reachable
+     */
+    void siblingReachabilityChanged(bool reachable);
+
+    /**
+     * @brief Get the number of the paths parked until the sibling BMC is
+     *        reachable.
+     */
+    size_t getParkedSyncsCount() const
     {
-        // TODO: It should be decided based on
-        //       the xyz.openbmc_project.Network.Neighbor DBus interface,
-        //       managed by the network daemon.
-        //       For now, return as false to treat the sibling BMC is available.
-        return false;
+        size_t count{0};
+        for (const auto& paths : _parkedSyncs | std::views::values)
+        {
+            count += paths.size();
+        }
+        return count;
     }
 
     /**
@@ -151,6 +435,51 @@ class Manager
      */
     void setSyncEventsHealth(const SyncEventsHealth& syncEventsHealth);
 
+    /**
+     * @brief Helper API fetches the per configuration results of the last
+     *        full sync.
+     */
+    const std::vector<SyncResult>& getFullSyncResults() const
+    {
+        return _fullSyncResults;
+    }
+
+    /**
+     * @brief Helper API fetches the statistics of the rsync slots granted to
+     *        the given priority, that is the number of rsync runs.
+     *
+     * @param[in] priority - The priority of the syncs
+     */
+    const async::SyncScheduler::Stats&
+        getSyncStats(async::SyncPriority priority) const
+    {
+        return _syncScheduler.getStats(priority);
+    }
+
+    /**
+     * @brief API to get the progress of the ongoing or the last full sync.
+     *
+     *        - The remaining time is estimated from the elapsed time and the
+     *          ratio of the estimated size of the completed configurations,
+     *          or of the completed count if the sizes are not known.
+     *
+     * @return The progress, all zero if no full sync is started.
+     */
+    FullSyncProgress getFullSyncProgress() const;
+
+    /**
+     * @brief API to estimate the data which a full sync would transfer.
+     *
+     *        - The full sync eligible configurations are synced by rsync
+     *          with --dry-run, hence nothing is changed and the sibling is
+     *          not notified.
+     *        - The dry-runs share the sync slots at the full sync priority,
+     *          which limits the concurrency.
+     *
+     * @return The per configuration estimates
+     */
+    sdbusplus::async::task<std::vector<SyncEstimate>> estimateFullSync();
+
   private:
     /**
      * @brief A helper API to start the data sync operation.
@@ -164,6 +493,24 @@ class Manager
      */
     sdbusplus::async::task<> parseConfiguration();
 
+    /**
+     * @brief API to get the identifier of the data sync configuration and
+     *        the BMC role, which the sync journal is valid for.
+     *
+     * @return The identifier which doesn't depend on the order of the
+     *         configurations.
+     */
+    uint64_t getConfigurationId() const;
+
+    /**
+     * @brief API to sync the paths which were pending in the sync journal
+     *        of the previous run, instead of a full sync.
+     *
+     * @param[in] pendingPaths - The paths pending to sync
+     */
+    sdbusplus::async::task<>
+        replaySyncJournal(std::vector<fs::path> pendingPaths);
+
     /**
      * @brief API to process the unprocessed notify requests if any during
      *        startup.
@@ -202,19 +549,62 @@ class Manager
                                    const std::string& srcPath);
 
     /**
-     * @brief API to frame the RSYNC CLI command
+     * @brief API to frame the RSYNC job template of the given configuration
+     *        in the given mode, that is the options and the destination.
+     *
+     * @param[in] mode - enum RsyncMode : sync or notify
+     * @param[in] dataSyncCfg - The data sync config to sync
+     *
+     * @return The RSYNC job without any source path
+     */
+    rsync::RsyncJob
+        getRsyncJobTemplate(RsyncMode mode,
+                            const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief API to frame the RSYNC job to sync the given path.
+     *
+     *        The job is copied from the template of the configuration and
+     *        the mode, which is framed once upon the first job, and only the
+     *        source paths are added to it.
      *
      * @param[in] mode - enum RsyncMode : sync or notify
      * @param[in] dataSyncCfg - The data sync config to sync
      * @param[in] srcPath - The modified path inside the cfg path.
      *                      Will be empty if not available.
-     * @param[out] cmd - string where the framed RSYNC command holds.
+     *
+     * @return The RSYNC job, which has no source path if none of the
+     *         configured include paths exists.
+     */
+    rsync::RsyncJob getRsyncJob(RsyncMode mode,
+                                const config::DataSyncConfig& dataSyncCfg,
+                                const fs::path& srcPath);
+
+    /**
+     * @brief API to sync the given path to the sibling BMC.
+     *
+     *        - If the path is already in progress, it is not synced, instead
+     *          it is marked to sync again since the in-progress sync might
+     *          have already transferred the path.
+     *        - Once the sync completes, the path is synced once again if it is
+     *          marked during the sync, so that any number of modifications
+     *          during a sync results in a single follow-up sync.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] srcPath - The modified path inside the cfg path, if available.
+     * @param[in] mode - enum RsyncMode : Sync or ShardRootSync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[out] syncResult - The rsync exit code and the transferred bytes
+     *                          are updated if given.
+     *
+     * @return Returns true if the last sync succeeds or if the path is marked
+     *         to sync again; otherwise, returns false
      */
-    // Disabled because this function conditionally accesses class members when
-    // unit tests are not enabled.
-    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-    void getRsyncCmd(RsyncMode mode, const config::DataSyncConfig& dataSyncCfg,
-                     const std::string& srcPath, std::string& cmd);
+    sdbusplus::async::task<bool> syncData(
+        const config::DataSyncConfig& dataSyncCfg,
+        fs::path srcPath = fs::path{}, RsyncMode mode = RsyncMode::Sync,
+        async::SyncPriority priority = async::SyncPriority::Immediate,
+        SyncResult* syncResult = nullptr);
 
     /**
      * @brief A helper rsync wrapper API that syncs data to sibling
@@ -224,13 +614,265 @@ class Manager
      * @param[in] dataSyncCfg - The data sync config to sync
      * @param[in] srcPath - The modified path inside the cfg path, if available.
      * @param[in] retryCount - The current retry attempt count
+     * @param[in] mode - enum RsyncMode : Sync or ShardRootSync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[out] syncResult - The rsync exit code and the transferred bytes
+     *                          are updated if given.
      *
      * @return Returns true if sync succeeds; otherwise, returns false
      *
      */
     sdbusplus::async::task<bool>
-        syncData(const config::DataSyncConfig& dataSyncCfg,
-                 fs::path srcPath = fs::path{}, size_t retryCount = 0);
+        runSync(const config::DataSyncConfig& dataSyncCfg, fs::path srcPath,
+                size_t retryCount, RsyncMode mode,
+                async::SyncPriority priority, SyncResult* syncResult);
+
+    /**
+     * @brief API to sync the configurations of the full sync queue one after
+     *        another until the queue is empty.
+     *
+     *        - The full sync runs a bounded number of the workers so that
+     *          the configurations are synced in the queued order.
+     *        - The completion of a criticality tier is reported as soon as
+     *          its last configuration completes.
+     *
+     * @param[in] queue - The full sync queue
+     */
+    sdbusplus::async::task<>
+        runFullSyncWorker(std::shared_ptr<FullSyncQueue> queue);
+
+    /**
+     * @brief API to estimate the data which the sync of a configuration
+     *        would transfer by a dry-run.
+     *
+     * @param[in] dataSyncCfg - The data sync config to estimate
+     * @param[out] syncEstimate - The estimate of the configuration
+     */
+    sdbusplus::async::task<>
+        estimateSync(const config::DataSyncConfig& dataSyncCfg,
+                     SyncEstimate& syncEstimate);
+
+    /**
+     * @brief API to account the completed configuration in the full sync
+     *        progress and to report the progress.
+     *
+     *        - The progress is reported at most once in the
+     *          progressReportInterval, and upon the completion.
+     *
+     * @param[in] queue - The full sync queue
+     * @param[in] index - The index of the completed configuration
+     */
+    void updateFullSyncProgress(FullSyncQueue& queue, size_t index);
+
+    /**
+     * @brief API to sync the modified paths received by a wakeup, including
+     *        the paths which are renamed or moved inside the configured
+     *        paths.
+     *
+     *        - rsync can't rename a path in the sibling, hence the new paths
+     *          are synced first by a single rsync using the data of the old
+     *          paths, which are still in the sibling, as the basis so that
+     *          only the differences are transferred, and then the old paths
+     *          are deleted along with the other modified paths.
+     *        - The basis is looked up only in the destination directory of
+     *          the new path, hence a move across the directories is synced
+     *          as a delete and a copy.
+     *
+     * @param[in] entries - The list of modified paths, and the old paths
+     * @param[in] movedEntries - The list of the new paths
+     *
+     * @return Returns true if all the paths are synced; otherwise, false
+     */
+    sdbusplus::async::task<bool>
+        syncDataChanges(std::vector<SyncEntry> entries,
+                        std::vector<SyncEntry> movedEntries);
+
+    /**
+     * @brief API to sync the given list of modified paths with a minimum
+     *        number of rsync invocations.
+     *
+     *        - The entries are grouped by the destination path and the
+     *          exclude list since those are part of the rsync command, and
+     *          each group is synced by a single rsync which reads the list
+     *          of paths from its stdin (--files-from).
+     *        - The exit code and retry are handled per group.
+     *
+     * @param[in] entries - The list of modified paths to sync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[in] mode - enum RsyncMode : BatchSync or MoveSync
+     *
+     * @return Returns true if all the groups are synced; otherwise, false
+     */
+    sdbusplus::async::task<bool> syncBatch(
+        std::vector<SyncEntry> entries,
+        async::SyncPriority priority = async::SyncPriority::Immediate,
+        RsyncMode mode = RsyncMode::BatchSync);
+
+    /**
+     * @brief A helper API to sync the group of modified paths which share the
+     *        same rsync command using a single rsync.
+     *
+     *        - A path which is already in progress is not synced, instead it
+     *          is marked to sync again after its in-progress sync.
+     *        - The paths which are marked to sync again during the batch are
+     *          synced again as one batch after the batch completes.
+     *
+     * @param[in] entries - The list of modified paths to sync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[in] mode - enum RsyncMode : BatchSync or MoveSync
+     *
+     * @return Returns true if sync succeeds; otherwise, returns false
+     */
+    sdbusplus::async::task<bool> syncBatchGroup(
+        const std::vector<SyncEntry>& entries,
+        async::SyncPriority priority = async::SyncPriority::Immediate,
+        RsyncMode mode = RsyncMode::BatchSync);
+
+    /**
+     * @brief A helper API to run a single rsync for the given batch of
+     *        modified paths and to retry on failure.
+     *
+     * @param[in] batchEntries - The list of modified paths to sync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[out] syncResult - The rsync exit code and the transferred bytes
+     *                          are updated if given.
+     * @param[in] mode - enum RsyncMode : BatchSync or MoveSync
+     *
+     * @return Returns true if sync succeeds; otherwise, returns false
+     */
+    sdbusplus::async::task<bool> runBatchSync(
+        const std::vector<SyncEntry>& batchEntries,
+        async::SyncPriority priority = async::SyncPriority::Immediate,
+        SyncResult* syncResult = nullptr,
+        RsyncMode mode = RsyncMode::BatchSync);
+
+    /**
+     * @brief API to fully sync a directory configured with the shards by
+     *        parallel rsyncs.
+     *
+     *        - The subdirectories are split into the hash buckets of their
+     *          names, and each shard is synced by a single rsync which reads
+     *          its subdirectories from stdin, hence the deletion is scoped to
+     *          the subdirectories of the shard.
+     *        - The top level of the directory is synced without recursion to
+     *          sync its files and to delete the removed subdirectories.
+     *        - The directory is synced by a single rsync if it doesn't have
+     *          enough subdirectories to shard.
+     *        - If the changed subtrees are given, only those are synced, and
+     *          the top level only if it is changed.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[out] syncResult - The merged result of all the shards
+     * @param[in] changedSubtrees - The names of the changed subdirectories
+     *                              and digest::rootKey for the top level,
+     *                              std::nullopt to sync all.
+     *
+     * @return Returns true if all the shards are synced; otherwise, false
+     */
+    sdbusplus::async::task<bool>
+        runShardedFullSync(
+            const config::DataSyncConfig& dataSyncCfg, SyncResult& syncResult,
+            std::optional<std::set<std::string>> changedSubtrees =
+                std::nullopt);
+
+    /**
+     * @brief API to check whether the full sync of a configuration can skip
+     *        the subtrees which are not changed since the sibling received
+     *        them.
+     *
+     *        - Only the directories synced from the active BMC are eligible,
+     *          since the passive BMC doesn't change those.
+     *
+     * @param[in] dataSyncCfg - The data sync config to check
+     *
+     * @return True if eligible; otherwise False.
+     */
+    static bool isDigestEligible(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief API to get the subtrees of a configuration which changed since
+     *        the sibling received those by the previous full sync.
+     *
+     *        - The digests of the subtrees are kept in the queue to send
+     *          those to the sibling once synced.
+     *
+     * @param[in] queue - The full sync queue
+     * @param[in] index - The index of the configuration
+     *
+     * @return The changed subtrees, std::nullopt if not known and hence
+     *         all need to sync.
+     */
+    sdbusplus::async::task<std::optional<std::set<std::string>>>
+        getChangedSubtrees(FullSyncQueue& queue, size_t index);
+
+    /**
+     * @brief API to digest the whole tree of the given digester in slices
+     *        which yield to the async context in between, so that digesting
+     *        a huge tree doesn't stall the other coroutines.
+     *
+     * @param[in] digester - The digester of the tree
+     */
+    sdbusplus::async::task<> walkDigester(digest::TreeDigester& digester);
+
+    /**
+     * @brief API to fetch the digests of the subtrees which the sibling
+     *        received by the previous full sync.
+     *
+     *        - The digests are fetched through the rsync daemon of the
+     *          sibling, in a full sync slot.
+     *        - The digests are not used if any sync failed since then, as
+     *          the sibling may have partially applied changes.
+     *        - The digests are not fetched if the sibling is unreachable.
+     *
+     * @return The digests per configured path, empty if not available.
+     */
+    sdbusplus::async::task<std::map<std::string, digest::SubtreeDigests>>
+        fetchSiblingDigests();
+
+    /**
+     * @brief API to send the digests of the synced subtrees to the sibling
+     *        to compare against in the next full sync.
+     *
+     * @param[in] digests - The digests per configured path
+     */
+    sdbusplus::async::task<> sendSiblingDigests(
+        std::map<std::string, digest::SubtreeDigests> digests);
+
+    /**
+     * @brief API to get the rsync URL of the root of the sibling BMC
+     *        filesystem.
+     */
+    std::string getSiblingRsyncURL();
+
+    /**
+     * @brief API to park the sync of the given path until the sibling BMC
+     *        is reachable.
+     *
+     *        - The paths of a configuration collapse into the whole
+     *          configuration once too many are parked.
+     *
+     * @param[in] dataSyncCfg - The data sync config of the path
+     * @param[in] srcPath - The path to sync, empty to sync the whole
+     *                      configuration
+     */
+    void parkSync(const config::DataSyncConfig& dataSyncCfg,
+                  const fs::path& srcPath);
+
+    /**
+     * @brief API to sync all the parked paths.
+     */
+    void drainParkedSyncs();
+
+    /**
+     * @brief API to probe the sibling BMC upon a failed rsync whose exit
+     *        code indicates a connection failure.
+     *
+     * @param[in] errCode - Rsync error code
+     *
+     * @return True if the sibling BMC is found not reachable; otherwise
+     *         False.
+     */
+    sdbusplus::async::task<bool> isSiblingUnreachable(int errCode);
 
     /**
      * @brief Wrapper API to frame and issue RSYNC command to sync the generated
@@ -251,14 +893,26 @@ class Manager
     /**
      * @brief Retry the data sync operation based on failure
      *
+     *        - The retry waits in the retry queue for the exponential
+     *          backoff with jitter from the retry interval.
+     *        - The retry of the path which is already queued is coalesced
+     *          with it, and the retry folded into another sync of the
+     *          configuration gets the result of that sync.
+     *
      * @param[in] cfg - Data sync configuration
      * @param[in] srcPath - Source path to be synced
      * @param[in] retryCount - Current retry attempt number
+     * @param[in] mode - enum RsyncMode : Sync or ShardRootSync
+     * @param[in] priority - The priority class to get the sync slot
+     * @param[out] syncResult - The rsync exit code and the transferred bytes
+     *                          are updated if given.
      *
      * @return true if the retry succeeds or can be skipped, false if failed
      */
-    sdbusplus::async::task<bool> retrySync(const config::DataSyncConfig& cfg,
-                                           fs::path srcPath, size_t retryCount);
+    sdbusplus::async::task<bool>
+        retrySync(const config::DataSyncConfig& cfg, fs::path srcPath,
+                  size_t retryCount, RsyncMode mode,
+                  async::SyncPriority priority, SyncResult* syncResult);
 
     /**
      * @brief A helper to API to monitor data to sync if its changed
@@ -270,12 +924,145 @@ class Manager
         monitorDataToSync(const config::DataSyncConfig& dataSyncCfg);
 
     /**
-     * @brief A helper to API to sync data periodically.
+     * @brief API to create the watcher backend as per the configured
+     *        WATCHER_BACKEND.
+     *
+     *        - The shared inotify backend is used if the configured backend
+     *          is not supported at runtime.
+     */
+    void createWatcherBackend();
+
+    /**
+     * @brief API to subscribe the given configuration for the data changes
+     *        in the watcher backend.
      *
      * @param[in] dataSyncCfg - The data sync config to sync
+     *
+     * @return True if subscribed or already subscribed; otherwise False.
+     */
+    bool subscribeDataChanges(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief API to monitor the data changes of all the subscribed
+     *        configurations from the watcher backend and to sync them.
+     *
+     *        - The data changes of all the configurations received upon a
+     *          wakeup are synced as one batch.
+     */
+    sdbusplus::async::task<> monitorDataChanges();
+
+    /**
+     * @brief API to recreate the watcher backend and to subscribe all the
+     *        subscribed configurations again.
+     *
+     *        - Used upon the event queue overflow so that the raised queued
+     *          events limit is applied and the watches are placed on the
+     *          current tree.
+     *        - A configuration falls back to its own watcher if it can't be
+     *          subscribed in the recreated backend.
+     */
+    void recreateWatcherBackend();
+
+    /**
+     * @brief API to get the inotify event masks to watch for the given
+     *        configuration.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     *
+     * @return The event masks to watch
+     */
+    static uint32_t
+        getEventMasksToWatch(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief API to process the data operations received for the given
+     *        configuration, the paths are either debounced or added to the
+     *        list of entries to sync.
+     *        The whole configured path is synced if the events are lost.
+     *        The paths are recorded in the sync journal before their syncs
+     *        are scheduled.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] dataOperations - The received data operations
+     * @param[out] entries - The list of entries to sync, including the old
+     *                       paths of the moves
+     * @param[out] movedEntries - The list of the new paths of the moves to
+     *                            sync before the entries
+     */
+    void processDataOperations(const config::DataSyncConfig& dataSyncCfg,
+                               const watch::DataOperations& dataOperations,
+                               std::vector<SyncEntry>& entries,
+                               std::vector<SyncEntry>& movedEntries);
+
+    /**
+     * @brief API to add the modified path into the debounce dirty list of the
+     *        given configuration and to schedule the flush if not scheduled.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     * @param[in] path - The modified path inside the cfg path
+     */
+    void scheduleDebouncedSync(const config::DataSyncConfig& dataSyncCfg,
+                               const fs::path& path);
+
+    /**
+     * @brief API to sync the debounced dirty paths of the given configuration
+     *        once there are no further changes within the settle window or
+     *        the max latency since the first change is elapsed.
+     *
+     * @param[in] dataSyncCfg - The data sync config to sync
+     */
+    sdbusplus::async::task<>
+        flushDebouncedSyncs(const config::DataSyncConfig& dataSyncCfg);
+
+    /**
+     * @brief API to sync all the periodic configurations from a single
+     *        timer wheel.
+     *
+     *        - The first tick of each configuration is delayed by a random
+     *          jitter so that the syncs don't start at once, e.g. after a
+     *          failover.
+     *        - The configurations whose ticks fall within the tolerance of
+     *          the earliest tick fire together and are synced as one batch,
+     *          and their next ticks are aligned to the same phase.
+     *        - The tick is skipped if the previous sync of the configuration
+     *          is still in progress.
+     */
+    sdbusplus::async::task<> monitorPeriodicSyncs();
+
+    /**
+     * @brief API to sync the periodic configurations which fired together
+     *        as one batch.
+     *
+     *        - The tick is skipped if the digests of the configured paths
+     *          are the same as at the last successful sync.
+     *        - The interval doubles upon each skipped tick up to the max
+     *          periodicity, if configured, and resets upon a change.
+     *        - The configurations without the include list are synced by
+     *          the batched rsync, the rest by their own rsync.
+     *        - The digests are recorded as synced only if the sync
+     *          succeeds.
+     *
+     * @param[in] schedule - The timer wheel of the periodic syncs
+     * @param[in] indices - The index of the configurations which fired
+     * @param[in] firedAt - The time at which the configurations fired
      */
     sdbusplus::async::task<>
-        monitorTimerToSync(const config::DataSyncConfig& dataSyncCfg);
+        syncPeriodicBatch(std::shared_ptr<PeriodicSchedule> schedule,
+                          std::vector<size_t> indices,
+                          std::chrono::steady_clock::time_point firedAt);
+
+    /**
+     * @brief API to get the digests of the paths of the given configuration
+     *        to check whether anything to sync is changed.
+     *
+     *        - The directories are digested in slices by walkDigester().
+     *
+     * @param[in] dataSyncCfg - The data sync config
+     *
+     * @return The digests, std::nullopt if not known.
+     */
+    sdbusplus::async::task<std::optional<std::vector<digest::Digest>>>
+        getChangeDigests(const config::DataSyncConfig& dataSyncCfg);
 
     /**
      * @brief A helper to API Checks if the data can be synchronize.
@@ -301,13 +1088,21 @@ class Manager
     static bool isRetryEligible(uint8_t errCode) noexcept;
 
     /**
-     * @brief Register SIGUSR1 signal handler using signalfd
+     * @brief Register SIGUSR1 and SIGUSR2 signal handler using signalfd
      *
-     * Sets up signalfd to receive SIGUSR1 signals and creates an fdio instance
-     * to monitor it.
+     * Sets up signalfd to receive SIGUSR1 and SIGUSR2 signals and creates an
+     * fdio instance to monitor it.
      */
     void registerSignalHandler();
 
+    /**
+     * @brief Write the full sync estimate to a JSON file
+     *
+     * The method will estimate the data which a full sync would transfer
+     * and dump the per configuration and the total counts into a JSON file.
+     */
+    sdbusplus::async::task<> dumpFullSyncEstimateToFile();
+
     /**
      * @brief Write all watched paths to a JSON file
      *
@@ -319,8 +1114,9 @@ class Manager
     /**
      * @brief Collect all currently watched paths from all DataWatcher instances
      *
-     * Iterates through all registered DataWatcher instances and collects their
-     * watched paths into a JSON structure.
+     * Iterates through all registered DataWatcher instances and the watcher
+     * backend subscribers and collects their watched paths into a JSON
+     * structure.
      *
      * @returns nlohmann::json - JSON object with config_path → watched_paths
      *          mapping and timestamp
@@ -368,6 +1164,95 @@ class Manager
      */
     std::map<fs::path, std::unique_ptr<watch::inotify::DataWatcher>>
         _activeWatchers;
+
+    /**
+     * @brief The watcher backend which monitors all the configurations
+     *        for immediate sync.
+     */
+    std::unique_ptr<watch::WatcherBackend> _watcherBackend;
+
+    /**
+     * @brief Map of the watcher backend subscribers to their configurations
+     */
+    std::map<watch::SubscriberId, const config::DataSyncConfig*> _subscribers;
+
+    /**
+     * @brief Indicates whether the data changes from the watcher backend are
+     *        being monitored.
+     */
+    bool _dataChangesMonitored{false};
+
+    /**
+     * @brief Indicates whether the periodic syncs are being monitored.
+     */
+    bool _periodicSyncsMonitored{false};
+
+    /**
+     * @brief The number of the event queue overflows which required the
+     *        configured paths to be resynced.
+     */
+    size_t _queueOverflowCount{0};
+
+    /**
+     * @brief The journal of the modified paths which are pending to sync
+     */
+    persist::SyncJournal _syncJournal;
+
+    /**
+     * @brief The scheduler to bound the number of the concurrent rsync
+     *        processes of all the sync jobs.
+     */
+    async::SyncScheduler _syncScheduler;
+
+    /**
+     * @brief The queue of the failed syncs waiting to be retried.
+     */
+    async::RetryQueue _retryQueue;
+
+    /**
+     * @brief The RSYNC job templates per configuration and mode.
+     */
+    std::map<std::pair<const config::DataSyncConfig*, RsyncMode>,
+             rsync::RsyncJob>
+        _rsyncJobTemplates;
+
+    /**
+     * @brief The monitor of the sibling BMC reachability.
+     */
+    std::unique_ptr<async::SiblingMonitor> _siblingMonitor;
+
+    /**
+     * @brief Indicates whether the sibling BMC is reachable to sync.
+     */
+    bool _siblingReachable{true};
+
+    /**
+     * @brief The paths parked per configuration until the sibling BMC is
+     *        reachable, an empty path denotes the whole configuration.
+     */
+    std::map<const config::DataSyncConfig*, std::set<fs::path>> _parkedSyncs;
+
+    /**
+     * @brief The per configuration results of the last full sync.
+     */
+    std::vector<SyncResult> _fullSyncResults;
+
+    /**
+     * @brief The progress of the full sync to resume it if interrupted
+     */
+    persist::FullSyncCheckpoint _fullSyncCheckpoint;
+
+    /**
+     * @brief The queue of the ongoing or the last full sync to get its
+     *        progress.
+     */
+    std::shared_ptr<FullSyncQueue> _fullSyncQueue;
+
+    /**
+     * @brief Whether a full sync estimate is ongoing, to ignore the
+     *        requests meanwhile.
+     */
+    bool _fullSyncEstimateInProgress{false};
 };
 
 } // namespace data_sync
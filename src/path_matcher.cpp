@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_matcher.hpp"
+
+#include <fnmatch.h>
+
+#include <algorithm>
+
+namespace data_sync::config
+{
+
+namespace
+{
+
+/**
+ * @brief The glob component which matches zero or more components
+ */
+constexpr auto anyDepthGlob = "**";
+
+} // namespace
+
+PathMatcher::PathMatcher(const std::unordered_set<fs::path>& patterns) :
+    _root(std::make_unique<Node>())
+{
+    std::ranges::for_each(patterns,
+                          [this](const auto& pattern) { addPattern(pattern); });
+    std::ranges::sort(_paths);
+}
+
+PathMatcher::PathMatcher(const PathMatcher& pathMatcher) :
+    _root(clone(*pathMatcher._root)), _paths(pathMatcher._paths)
+{}
+
+PathMatcher& PathMatcher::operator=(const PathMatcher& pathMatcher)
+{
+    if (this != &pathMatcher)
+    {
+        _root = clone(*pathMatcher._root);
+        _paths = pathMatcher._paths;
+    }
+    return *this;
+}
+
+bool PathMatcher::hasGlob(const std::string& pattern)
+{
+    return pattern.find_first_of("*?[") != std::string::npos;
+}
+
+void PathMatcher::addPattern(const fs::path& pattern)
+{
+    if (pattern.empty())
+    {
+        return;
+    }
+
+    const bool isAbsolute = pattern.is_absolute();
+    if (isAbsolute && !hasGlob(pattern.string()))
+    {
+        _paths.emplace_back(pattern);
+    }
+
+    Node* node = _root.get();
+    if (!isAbsolute)
+    {
+        // The relative patterns are matched at any depth.
+        auto& child = node->_globChildren[anyDepthGlob];
+        if (!child)
+        {
+            child = std::make_unique<Node>();
+            child->_anyDepth = true;
+        }
+        node = child.get();
+    }
+
+    for (const auto& component : pattern)
+    {
+        // The trailing slash is an empty component.
+        if (component.empty())
+        {
+            continue;
+        }
+
+        const auto& name = component.string();
+        auto& child = hasGlob(name) ? node->_globChildren[name]
+                                    : node->_children[name];
+        if (!child)
+        {
+            child = std::make_unique<Node>();
+            child->_anyDepth = (name == anyDepthGlob);
+        }
+        node = child.get();
+    }
+
+    // A directory only pattern doesn't restrict the same path configured
+    // without the trailing slash.
+    const bool dirOnly = !pattern.has_filename();
+    node->_dirOnly = node->_terminal ? (node->_dirOnly && dirOnly) : dirOnly;
+    node->_terminal = true;
+}
+
+void PathMatcher::addAnyDepthNodes(std::vector<const Node*>& nodes)
+{
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (auto child = nodes[i]->_globChildren.find(anyDepthGlob);
+            child != nodes[i]->_globChildren.end() &&
+            !std::ranges::contains(nodes, child->second.get()))
+        {
+            nodes.emplace_back(child->second.get());
+        }
+    }
+}
+
+bool PathMatcher::matches(const fs::path& path, bool isDir) const
+{
+    // A path with the trailing slash is a directory.
+    isDir = isDir || !path.has_filename();
+
+    std::vector<const Node*> activeNodes{_root.get()};
+    addAnyDepthNodes(activeNodes);
+
+    std::vector<const Node*> nextNodes;
+    for (const auto& component : path)
+    {
+        if (component.empty())
+        {
+            continue;
+        }
+
+        // A pattern matched one of the parent directories.
+        if (std::ranges::any_of(activeNodes, [](const auto* node) {
+            return node->_terminal;
+        }))
+        {
+            return true;
+        }
+
+        const auto& name = component.string();
+        nextNodes.clear();
+        for (const auto* node : activeNodes)
+        {
+            if (node->_anyDepth)
+            {
+                nextNodes.emplace_back(node);
+            }
+            if (auto child = node->_children.find(name);
+                child != node->_children.end())
+            {
+                nextNodes.emplace_back(child->second.get());
+            }
+            for (const auto& [glob, child] : node->_globChildren)
+            {
+                if (glob != anyDepthGlob &&
+                    fnmatch(glob.c_str(), name.c_str(), 0) == 0)
+                {
+                    nextNodes.emplace_back(child.get());
+                }
+            }
+        }
+        addAnyDepthNodes(nextNodes);
+
+        if (nextNodes.empty())
+        {
+            return false;
+        }
+        std::swap(activeNodes, nextNodes);
+    }
+
+    return std::ranges::any_of(activeNodes, [isDir](const auto* node) {
+        return node->_terminal && (!node->_dirOnly || isDir);
+    });
+}
+
+bool PathMatcher::isParentOfPattern(const fs::path& path) const
+{
+    const Node* node = _root.get();
+    for (const auto& component : path)
+    {
+        if (component.empty())
+        {
+            continue;
+        }
+
+        auto child = node->_children.find(component.string());
+        if (child == node->_children.end())
+        {
+            return false;
+        }
+        node = child->second.get();
+    }
+    return !node->_children.empty();
+}
+
+std::unique_ptr<PathMatcher::Node> PathMatcher::clone(const Node& node)
+{
+    auto cloned = std::make_unique<Node>();
+    cloned->_terminal = node._terminal;
+    cloned->_dirOnly = node._dirOnly;
+    cloned->_anyDepth = node._anyDepth;
+    for (const auto& [name, child] : node._children)
+    {
+        cloned->_children.emplace(name, clone(*child));
+    }
+    for (const auto& [glob, child] : node._globChildren)
+    {
+        cloned->_globChildren.emplace(glob, clone(*child));
+    }
+    return cloned;
+}
+
+} // namespace data_sync::config
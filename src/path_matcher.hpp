@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace data_sync::config
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class PathMatcher
+ *
+ * @brief The compiled form of the configured include or exclude list which
+ *        decides whether a path is matched in O(path depth) without any
+ *        filesystem access.
+ *
+ *        - The patterns are compiled into a component wise prefix trie, so a
+ *          path matches if a pattern is the same as the path or one of its
+ *          parent directories.
+ *        - A pattern component can be a glob as per fnmatch(3) and "**"
+ *          matches zero or more components.
+ *        - A pattern which is not an absolute path is matched at any depth,
+ *          Eg: "*.tmp" matches all the files with the tmp extension.
+ *        - A pattern with the trailing slash matches only directories.
+ */
+class PathMatcher
+{
+  public:
+    /**
+     * @brief Constructor
+     *
+     * Compiles the given patterns.
+     *
+     * @param[in] patterns - The list of paths or glob patterns
+     */
+    explicit PathMatcher(const std::unordered_set<fs::path>& patterns);
+
+    PathMatcher(const PathMatcher& pathMatcher);
+    PathMatcher& operator=(const PathMatcher& pathMatcher);
+    PathMatcher(PathMatcher&&) = default;
+    PathMatcher& operator=(PathMatcher&&) = default;
+    ~PathMatcher() = default;
+
+    /**
+     * @brief API to check whether the given path is matched by any pattern
+     *        or is inside a matched directory.
+     *
+     * @param[in] path - The absolute path to check
+     * @param[in] isDir - Whether the path is a directory, a path with the
+     *                    trailing slash is always a directory.
+     *
+     * @return True if matched; otherwise False.
+     */
+    bool matches(const fs::path& path, bool isDir) const;
+
+    /**
+     * @brief API to check whether the given path is a parent directory of
+     *        any absolute path pattern.
+     *
+     * @param[in] path - The absolute path to check
+     *
+     * @return True if the path is a parent; otherwise False.
+     */
+    bool isParentOfPattern(const fs::path& path) const;
+
+    /**
+     * @brief API to get the configured absolute path patterns which don't
+     *        have any glob.
+     *
+     * @return The list of the absolute paths
+     */
+    const std::vector<fs::path>& getPaths() const
+    {
+        return _paths;
+    }
+
+    /**
+     * @brief API to check whether the given pattern has any glob.
+     *
+     * @param[in] pattern - The pattern to check
+     *
+     * @return True if has glob; otherwise False.
+     */
+    static bool hasGlob(const std::string& pattern);
+
+  private:
+    /**
+     * @brief A node in the trie which represents a pattern component.
+     */
+    struct Node
+    {
+        /**
+         * @brief Indicates a pattern ends at the node.
+         */
+        bool _terminal{false};
+
+        /**
+         * @brief Indicates the pattern ended at the node matches only
+         *        directories.
+         */
+        bool _dirOnly{false};
+
+        /**
+         * @brief Indicates the node is a "**" which consumes any number of
+         *        components.
+         */
+        bool _anyDepth{false};
+
+        /**
+         * @brief The child nodes of the literal components.
+         */
+        std::unordered_map<std::string, std::unique_ptr<Node>> _children;
+
+        /**
+         * @brief The child nodes of the glob components.
+         */
+        std::map<std::string, std::unique_ptr<Node>> _globChildren;
+    };
+
+    /**
+     * @brief API to add the given pattern into the trie.
+     *
+     * @param[in] pattern - The path or glob pattern
+     */
+    void addPattern(const fs::path& pattern);
+
+    /**
+     * @brief API to add the nodes reachable without consuming any component
+     *        into the given list of active nodes.
+     *
+     * @param[in,out] nodes - The list of active nodes
+     */
+    static void addAnyDepthNodes(std::vector<const Node*>& nodes);
+
+    /**
+     * @brief API to clone the given trie.
+     *
+     * @param[in] node - The root node of the trie to clone
+     *
+     * @return The cloned root node
+     */
+    static std::unique_ptr<Node> clone(const Node& node);
+
+    /**
+     * @brief The root node of the trie
+     */
+    std::unique_ptr<Node> _root;
+
+    /**
+     * @brief The configured absolute path patterns which don't have any glob
+     */
+    std::vector<fs::path> _paths;
+};
+
+} // namespace data_sync::config
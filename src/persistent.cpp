@@ -11,6 +11,12 @@ namespace data_sync::persist
 {
 std::filesystem::path DBusPropDataFile =
     "/var/lib/phosphor-data-sync/persistence/dbus_props.json";
+std::filesystem::path FullSyncStatsFile =
+    "/var/lib/phosphor-data-sync/persistence/full_sync_stats.json";
+std::filesystem::path ReceivedDigestsFile =
+    "/var/lib/phosphor-data-sync/persistence/received_digests.json";
+std::filesystem::path SiblingDigestsFile =
+    "/var/lib/phosphor-data-sync/persistence/sibling_digests.json";
 
 std::optional<nlohmann::json> readFile(const std::filesystem::path& path)
 {
@@ -11,12 +11,17 @@ namespace data_sync::persist
 {
 
 extern std::filesystem::path DBusPropDataFile;
+extern std::filesystem::path FullSyncStatsFile;
+extern std::filesystem::path ReceivedDigestsFile;
+extern std::filesystem::path SiblingDigestsFile;
 
 namespace key
 {
 constexpr auto disable = "Disable";
 constexpr auto fullSyncStatus = "FullSyncStatus";
 constexpr auto syncEventsHealth = "SyncEventsHealth";
+constexpr auto fullSyncSizes = "FullSyncSizes";
+constexpr auto fullSyncDigests = "FullSyncDigests";
 } // namespace key
 
 namespace util
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "retry_queue.hpp"
+
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <experimental/scope>
+#include <random>
+#include <ranges>
+
+namespace data_sync::async
+{
+
+RetryQueue::RetryQueue(sdbusplus::async::context& ctx) :
+    _ctx(ctx),
+    _timerFd(timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+{
+    if (_timerFd() < 0)
+    {
+        lg2::error("Failed to create the timerfd of the retry queue, error: "
+                   "{ERROR}",
+                   "ERROR", strerror(errno));
+    }
+}
+
+std::chrono::milliseconds
+    RetryQueue::getBackoff(std::chrono::seconds retryInterval, size_t attempt,
+                           std::chrono::seconds maxInterval)
+{
+    using std::chrono::milliseconds;
+
+    const milliseconds maxBackoff{std::max(retryInterval, maxInterval)};
+    milliseconds backoff{retryInterval};
+    for (size_t count = 1; count < attempt && backoff < maxBackoff; ++count)
+    {
+        backoff *= 2;
+    }
+    backoff = std::min(backoff, maxBackoff);
+
+    thread_local std::mt19937 randomEngine{std::random_device{}()};
+    std::uniform_int_distribution<milliseconds::rep> jitter(
+        0, backoff.count() / 2);
+    return backoff - backoff / 2 + milliseconds{jitter(randomEngine)};
+}
+
+sdbusplus::async::task<RetryOutcome>
+    // NOLINTNEXTLINE
+    RetryQueue::wait(fs::path cfgPath, fs::path path,
+                     std::chrono::milliseconds backoff)
+{
+    using std::experimental::scope_exit;
+
+    Waiter waiter{utility::FD{eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)},
+                  std::nullopt};
+    if (_timerFd() < 0 || waiter._eventFd() < 0)
+    {
+        // Retry on its own rather than dropping the retry.
+        // NOLINTNEXTLINE
+        co_await sdbusplus::async::sleep_for(_ctx, backoff);
+        co_return RetryOutcome::Due;
+    }
+
+    Key key{std::move(cfgPath), std::move(path)};
+    const auto due = std::chrono::steady_clock::now() + backoff;
+    auto [retry, queued] = _retries.try_emplace(key, Retry{due, {}});
+    if (!queued)
+    {
+        // Join the queued retry, or queue again the retry which is in
+        // flight since it is failed or it may not cover this failure.
+        retry->second._due = retry->second._inFlight
+                                 ? due
+                                 : std::min(retry->second._due, due);
+        retry->second._inFlight = false;
+        retry->second._folded = false;
+    }
+    retry->second._waiters.emplace_back(&waiter);
+    schedule();
+
+    auto cleanup = scope_exit([this, &key, &waiter]() noexcept {
+        // The job is cancelled while waiting.
+        if (waiter._outcome.has_value())
+        {
+            return;
+        }
+        if (auto retry = _retries.find(key); retry != _retries.end())
+        {
+            std::erase(retry->second._waiters, &waiter);
+            if (retry->second._waiters.empty() && !retry->second._inFlight)
+            {
+                _retries.erase(retry);
+            }
+        }
+    });
+
+    sdbusplus::async::fdio eventFdio(_ctx, waiter._eventFd());
+    while (!waiter._outcome.has_value())
+    {
+        // NOLINTNEXTLINE
+        co_await eventFdio.next();
+    }
+    co_return waiter._outcome.value();
+}
+
+void RetryQueue::complete(const fs::path& cfgPath, const fs::path& path,
+                          bool synced)
+{
+    auto retry = _retries.find(Key{cfgPath, path});
+    if (retry == _retries.end() || !retry->second._inFlight)
+    {
+        return;
+    }
+
+    if (!synced && retry->second._folded && !retry->second._waiters.empty())
+    {
+        // Retry as it was queued before the fold.
+        retry->second._inFlight = false;
+        retry->second._folded = false;
+        schedule();
+        return;
+    }
+
+    wakeUp(retry->second,
+           synced ? RetryOutcome::Synced : RetryOutcome::Failed);
+    _retries.erase(retry);
+}
+
+std::vector<fs::path> RetryQueue::fold(const fs::path& cfgPath)
+{
+    std::vector<fs::path> paths;
+    for (auto& [key, retry] : _retries)
+    {
+        if (key.first == cfgPath && !retry._inFlight)
+        {
+            retry._inFlight = true;
+            retry._folded = true;
+            paths.emplace_back(key.second);
+        }
+    }
+
+    if (!paths.empty())
+    {
+        lg2::debug("Folded [{COUNT}] pending retries of [{PATH}]", "COUNT",
+                   paths.size(), "PATH", cfgPath);
+        schedule();
+    }
+    return paths;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> RetryQueue::run()
+{
+    auto cleanup = std::experimental::scope_exit(
+        [this]() noexcept { _running = false; });
+
+    sdbusplus::async::fdio timerFdio(_ctx, _timerFd());
+    while (!_ctx.stop_requested() &&
+           std::ranges::any_of(_retries, [](const auto& retry) {
+        return !retry.second._inFlight;
+    }))
+    {
+        // NOLINTNEXTLINE
+        co_await timerFdio.next();
+
+        uint64_t expirations{0};
+        if (read(_timerFd(), &expirations, sizeof(expirations)) < 0)
+        {
+            // Re-armed meanwhile to a later retry.
+            continue;
+        }
+
+        // The first waiter of a due retry syncs again, the rest wait for
+        // its outcome.
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& retry : _retries | std::views::values)
+        {
+            if (retry._inFlight || retry._due > now || retry._waiters.empty())
+            {
+                continue;
+            }
+            auto* waiter = retry._waiters.front();
+            retry._waiters.erase(retry._waiters.begin());
+            retry._inFlight = true;
+            waiter->_outcome = RetryOutcome::Due;
+            eventfd_write(waiter->_eventFd(), 1);
+        }
+        schedule();
+    }
+    co_return;
+}
+
+void RetryQueue::schedule()
+{
+    std::optional<std::chrono::steady_clock::time_point> earliestDue;
+    for (const auto& retry : _retries | std::views::values)
+    {
+        if (!retry._inFlight &&
+            (!earliestDue.has_value() || retry._due < *earliestDue))
+        {
+            earliestDue = retry._due;
+        }
+    }
+
+    // A zero expiration disarms the timer, hence expire a due retry in
+    // a nanosecond.
+    itimerspec expiration{};
+    if (earliestDue.has_value())
+    {
+        const auto sinceEpoch = std::max(
+            earliestDue->time_since_epoch(),
+            std::chrono::steady_clock::now().time_since_epoch() +
+                std::chrono::nanoseconds{1});
+        const auto seconds =
+            std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+        expiration.it_value.tv_sec = seconds.count();
+        expiration.it_value.tv_nsec =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch -
+                                                                 seconds)
+                .count();
+    }
+    timerfd_settime(_timerFd(), TFD_TIMER_ABSTIME, &expiration, nullptr);
+
+    if (earliestDue.has_value() && !_running)
+    {
+        _running = true;
+        _ctx.spawn(run());
+    }
+}
+
+void RetryQueue::wakeUp(Retry& retry, RetryOutcome outcome)
+{
+    for (auto* waiter : std::exchange(retry._waiters, {}))
+    {
+        waiter->_outcome = outcome;
+        eventfd_write(waiter->_eventFd(), 1);
+    }
+}
+
+} // namespace data_sync::async
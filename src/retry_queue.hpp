@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace data_sync::async
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The outcome of waiting for a retry.
+ */
+enum class RetryOutcome
+{
+    /**
+     * @brief The retry is due, the waiter has to sync again and to report
+     *        the result via RetryQueue::complete().
+     */
+    Due,
+
+    /**
+     * @brief The path is synced by the coalesced retry or by the sync which
+     *        the retry is folded into.
+     */
+    Synced,
+
+    /**
+     * @brief The coalesced retry failed finally.
+     */
+    Failed
+};
+
+/**
+ * @class RetryQueue
+ *
+ * @brief The queue of the failed syncs waiting to be retried, shared by all
+ *        the sync jobs.
+ *
+ *        - A single timerfd armed to the earliest due retry drives the
+ *          retries of all the paths, so that a failed sync doesn't hold a
+ *          timer of its own.
+ *        - The retries of the same path of a configuration coalesce, the
+ *          first waiter retries once due and the rest get the outcome of
+ *          its retry.
+ *        - The pending retries of a configuration can be folded into the
+ *          next sync of the configuration, and the waiters get the outcome
+ *          of that sync instead of syncing separately.
+ */
+class RetryQueue
+{
+  public:
+    RetryQueue(const RetryQueue&) = delete;
+    RetryQueue& operator=(const RetryQueue&) = delete;
+    RetryQueue(RetryQueue&&) = delete;
+    RetryQueue& operator=(RetryQueue&&) = delete;
+    ~RetryQueue() = default;
+
+    /**
+     * @brief Constructor
+     *
+     *        The waiters sleep on their own if the timerfd can't be created.
+     *
+     * @param[in] ctx - The async context object
+     */
+    explicit RetryQueue(sdbusplus::async::context& ctx);
+
+    /**
+     * @brief API to get the delay before the given retry attempt.
+     *
+     *        - The delay doubles per attempt from the retry interval up to
+     *          the max interval, or the retry interval if it is longer.
+     *        - The delay is jittered between the half and the whole of it
+     *          so that the paths which failed at once, e.g. while the
+     *          sibling is down, don't retry in lockstep.
+     *
+     * @param[in] retryInterval - The retry interval of the configuration
+     * @param[in] attempt - The retry attempt, starting from 1
+     * @param[in] maxInterval - The upper limit of the delay
+     *
+     * @return The delay before the retry
+     */
+    static std::chrono::milliseconds
+        getBackoff(std::chrono::seconds retryInterval, size_t attempt,
+                   std::chrono::seconds maxInterval);
+
+    /**
+     * @brief API to wait for the retry of the given path.
+     *
+     *        If a retry of the same path is already queued the waiter joins
+     *        it, and the retry is due at the earlier of the two.
+     *
+     * @param[in] cfgPath - The configured path which the path belongs to
+     * @param[in] path - The path to retry
+     * @param[in] backoff - The delay before the retry
+     *
+     * @return The outcome of the retry
+     */
+    sdbusplus::async::task<RetryOutcome>
+        wait(fs::path cfgPath, fs::path path,
+             std::chrono::milliseconds backoff);
+
+    /**
+     * @brief API to report the result of the retry which was due or of the
+     *        sync which the retry was folded into.
+     *
+     *        - The waiters of the path get the outcome of the result.
+     *        - A folded retry is queued again as it was if the sync failed.
+     *        - Nothing is done if the path is not being retried.
+     *
+     * @param[in] cfgPath - The configured path which the path belongs to
+     * @param[in] path - The retried path
+     * @param[in] synced - Whether the path is synced
+     */
+    void complete(const fs::path& cfgPath, const fs::path& path, bool synced);
+
+    /**
+     * @brief API to fold the queued retries of the given configuration into
+     *        a sync which is about to run.
+     *
+     *        The caller has to sync the returned paths and to report the
+     *        result of each via complete().
+     *
+     * @param[in] cfgPath - The configured path
+     *
+     * @return The paths of the folded retries
+     */
+    std::vector<fs::path> fold(const fs::path& cfgPath);
+
+    /**
+     * @brief Get the number of the paths being retried.
+     */
+    size_t getPendingCount() const
+    {
+        return _retries.size();
+    }
+
+  private:
+    /**
+     * @brief A job waiting for a retry.
+     */
+    struct Waiter
+    {
+        /**
+         * @brief The eventfd which is signalled once the outcome is known
+         */
+        utility::FD _eventFd;
+
+        /**
+         * @brief The outcome of the retry
+         */
+        std::optional<RetryOutcome> _outcome;
+    };
+
+    /**
+     * @brief A path being retried.
+     */
+    struct Retry
+    {
+        /**
+         * @brief The time at which the retry is due
+         */
+        std::chrono::steady_clock::time_point _due;
+
+        /**
+         * @brief The jobs waiting for the retry, in the order of arrival
+         */
+        std::vector<Waiter*> _waiters;
+
+        /**
+         * @brief Whether the path is being synced, by the waiter which the
+         *        retry was due for or by the sync which it was folded into.
+         */
+        bool _inFlight{false};
+
+        /**
+         * @brief Whether the retry is folded into another sync
+         */
+        bool _folded{false};
+    };
+
+    /**
+     * @brief The configured path and the path being retried.
+     */
+    using Key = std::pair<fs::path, fs::path>;
+
+    /**
+     * @brief API to wake up the waiters whose retries are due as long as
+     *        any retry is queued.
+     */
+    sdbusplus::async::task<> run();
+
+    /**
+     * @brief API to arm the timerfd to the earliest queued retry, and to
+     *        start running the queue if required.
+     */
+    void schedule();
+
+    /**
+     * @brief API to wake up all the waiters of the given retry.
+     *
+     * @param[in] retry - The retry
+     * @param[in] outcome - The outcome of the retry
+     */
+    static void wakeUp(Retry& retry, RetryOutcome outcome);
+
+    /**
+     * @brief The async context object
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The timerfd which expires once the earliest retry is due
+     */
+    utility::FD _timerFd;
+
+    /**
+     * @brief The paths being retried
+     */
+    std::map<Key, Retry> _retries;
+
+    /**
+     * @brief Whether the queue is being run
+     */
+    bool _running{false};
+};
+
+} // namespace data_sync::async
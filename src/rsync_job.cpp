@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rsync_job.hpp"
+
+#include <utility>
+
+namespace data_sync::rsync
+{
+
+RsyncJob::RsyncJob(std::vector<std::string> options, std::string destination) :
+    _template(std::make_shared<const Template>(std::move(options),
+                                               std::move(destination)))
+{}
+
+RsyncJob& RsyncJob::addSource(const fs::path& source)
+{
+    _sources.emplace_back(source.string());
+    return *this;
+}
+
+std::vector<const char*> RsyncJob::getArgv() const
+{
+    std::vector<const char*> argv;
+    argv.reserve(_template->_options.size() + _sources.size() + 3);
+    argv.emplace_back("rsync");
+    for (const auto& option : _template->_options)
+    {
+        argv.emplace_back(option.c_str());
+    }
+    for (const auto& source : _sources)
+    {
+        argv.emplace_back(source.c_str());
+    }
+    if (!_template->_destination.empty())
+    {
+        argv.emplace_back(_template->_destination.c_str());
+    }
+    argv.emplace_back(nullptr);
+    return argv;
+}
+
+std::string RsyncJob::toString() const
+{
+    std::string cmd;
+    for (const auto* arg : getArgv())
+    {
+        if (arg != nullptr)
+        {
+            cmd.append(cmd.empty() ? "" : " ");
+            cmd.append(arg);
+        }
+    }
+    return cmd;
+}
+
+} // namespace data_sync::rsync
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace data_sync::rsync
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @class RsyncJob
+ *
+ * @brief The arguments of an rsync command, which is spawned without a shell.
+ *
+ *        - The options and the destination are the template of the job,
+ *          which is built once and shared by all the jobs copied from it,
+ *          so that a job only adds its source paths.
+ *        - The arguments are passed to rsync as they are, hence the paths
+ *          with spaces or quotes need no escaping.
+ */
+class RsyncJob
+{
+  public:
+    /**
+     * @brief Constructor
+     *
+     * @param[in] options - The rsync options, Eg: "--recursive"
+     * @param[in] destination - The destination of the sync, not passed if
+     *                          empty
+     */
+    RsyncJob(std::vector<std::string> options, std::string destination);
+
+    /**
+     * @brief API to add a source path to the job.
+     *
+     * @param[in] source - The source path
+     *
+     * @return The job itself
+     */
+    RsyncJob& addSource(const fs::path& source);
+
+    /**
+     * @brief Get whether any source path is added to the job.
+     */
+    bool hasSources() const
+    {
+        return !_sources.empty();
+    }
+
+    /**
+     * @brief Get the argument vector to spawn rsync with.
+     *
+     *        The vector starts with the program name and is terminated by
+     *        nullptr, and it refers to the job hence valid as long as the
+     *        job is not modified or destroyed.
+     */
+    std::vector<const char*> getArgv() const;
+
+    /**
+     * @brief Get the command line of the job to log.
+     */
+    std::string toString() const;
+
+  private:
+    /**
+     * @brief The options and the destination shared with the template.
+     */
+    struct Template
+    {
+        std::vector<std::string> _options;
+        std::string _destination;
+    };
+
+    /**
+     * @brief The template which the job is copied from
+     */
+    std::shared_ptr<const Template> _template;
+
+    /**
+     * @brief The source paths of the job
+     */
+    std::vector<std::string> _sources;
+};
+
+} // namespace data_sync::rsync
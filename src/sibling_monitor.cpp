@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sibling_monitor.hpp"
+
+#include "utility.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace data_sync::async
+{
+
+namespace
+{
+
+// The greeting which the rsync daemon sends upon the connection.
+constexpr std::string_view rsyncdGreeting{"@RSYNCD:"};
+
+} // namespace
+
+SiblingMonitor::SiblingMonitor(sdbusplus::async::context& ctx, uint16_t port,
+                               Callback callback,
+                               std::chrono::seconds probeInterval,
+                               std::chrono::seconds downProbeInterval,
+                               std::chrono::milliseconds probeTimeout) :
+    _ctx(ctx), _port(port), _callback(std::move(callback)),
+    _probeInterval(probeInterval), _downProbeInterval(downProbeInterval),
+    _probeTimeout(probeTimeout)
+{}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> SiblingMonitor::run()
+{
+    while (!_ctx.stop_requested())
+    {
+        // NOLINTNEXTLINE
+        co_await probe();
+
+        // NOLINTNEXTLINE
+        co_await sdbusplus::async::sleep_for(
+            _ctx, _reachable ? _probeInterval : _downProbeInterval);
+    }
+    co_return;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<bool> SiblingMonitor::probe()
+{
+    // NOLINTNEXTLINE
+    const bool reachable = co_await readGreeting();
+    if (reachable != _reachable)
+    {
+        _reachable = reachable;
+        if (reachable)
+        {
+            lg2::info("The sibling BMC is reachable again");
+        }
+        else
+        {
+            lg2::warning("The sibling BMC is not reachable via the port "
+                         "[{PORT}]",
+                         "PORT", _port);
+        }
+        _callback(reachable);
+    }
+    co_return reachable;
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<bool> SiblingMonitor::readGreeting()
+{
+    auto socketFd = std::make_shared<utility::FD>(
+        socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+    if ((*socketFd)() < 0)
+    {
+        // Keep the last known state as the sibling is not probed.
+        lg2::error("Failed to create the socket to probe the sibling BMC, "
+                   "error: {ERROR}",
+                   "ERROR", strerror(errno));
+        co_return _reachable;
+    }
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect((*socketFd)(), reinterpret_cast<sockaddr*>(&address),
+                sizeof(address)) < 0 &&
+        errno != EINPROGRESS)
+    {
+        co_return false;
+    }
+
+    // Shut the socket down once timed out so that the read below wakes up.
+    _ctx.spawn(sdbusplus::async::sleep_for(_ctx, _probeTimeout) |
+               stdexec::then([socketFd]() {
+        shutdown((*socketFd)(), SHUT_RDWR);
+    }));
+
+    sdbusplus::async::fdio socketFdio(_ctx, (*socketFd)());
+    std::string greeting;
+    while (!greeting.contains('\n') && greeting.size() < rsyncdGreeting.size())
+    {
+        std::array<char, 64> buffer{};
+        const auto size = read((*socketFd)(), buffer.data(), buffer.size());
+        if (size > 0)
+        {
+            greeting.append(buffer.data(), size);
+            continue;
+        }
+        if (size == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+        {
+            // Closed by the tunnel as the sibling can't be connected.
+            co_return false;
+        }
+        // NOLINTNEXTLINE
+        co_await socketFdio.next();
+    }
+    co_return greeting.starts_with(rsyncdGreeting);
+}
+
+} // namespace data_sync::async
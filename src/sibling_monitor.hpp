@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace data_sync::async
+{
+
+/**
+ * @class SiblingMonitor
+ *
+ * @brief To track whether the sibling BMC is reachable to sync.
+ *
+ *        - The sibling is probed by connecting to the given local port,
+ *          which is the stunnel client forwarding to the rsync daemon of
+ *          the sibling, and by reading the rsync daemon greeting. Hence
+ *          the probe fails if either the tunnel or the sibling is down,
+ *          without forking any process.
+ *        - The sibling is probed periodically, and more often while it is
+ *          not reachable so that the recovery is detected early.
+ *        - The callback is invoked only when the reachability changes.
+ */
+class SiblingMonitor
+{
+  public:
+    SiblingMonitor(const SiblingMonitor&) = delete;
+    SiblingMonitor& operator=(const SiblingMonitor&) = delete;
+    SiblingMonitor(SiblingMonitor&&) = delete;
+    SiblingMonitor& operator=(SiblingMonitor&&) = delete;
+    ~SiblingMonitor() = default;
+
+    /**
+     * @brief The callback to notify the reachability changes.
+     */
+    using Callback = std::function<void(bool reachable)>;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] ctx - The async context object
+     * @param[in] port - The local port to probe
+     * @param[in] callback - The callback to notify the reachability changes
+     * @param[in] probeInterval - The interval to probe the reachable sibling
+     * @param[in] downProbeInterval - The interval to probe the unreachable
+     *                                sibling
+     * @param[in] probeTimeout - The time to wait for the greeting
+     */
+    SiblingMonitor(sdbusplus::async::context& ctx, uint16_t port,
+                   Callback callback, std::chrono::seconds probeInterval,
+                   std::chrono::seconds downProbeInterval,
+                   std::chrono::milliseconds probeTimeout);
+
+    /**
+     * @brief API to probe the sibling periodically until the context is
+     *        stopped.
+     */
+    sdbusplus::async::task<> run();
+
+    /**
+     * @brief API to probe the sibling once and to update the reachability.
+     *
+     * @return True if the sibling is reachable; otherwise False.
+     */
+    sdbusplus::async::task<bool> probe();
+
+    /**
+     * @brief Get whether the sibling was reachable by the last probe.
+     */
+    bool isReachable() const
+    {
+        return _reachable;
+    }
+
+  private:
+    /**
+     * @brief API to connect to the probed port and to read the rsync daemon
+     *        greeting.
+     *
+     * @return True if the greeting is received; otherwise False.
+     */
+    sdbusplus::async::task<bool> readGreeting();
+
+    /**
+     * @brief The async context object
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The local port to probe
+     */
+    uint16_t _port;
+
+    /**
+     * @brief The callback to notify the reachability changes
+     */
+    Callback _callback;
+
+    /**
+     * @brief The interval to probe the reachable sibling
+     */
+    std::chrono::seconds _probeInterval;
+
+    /**
+     * @brief The interval to probe the unreachable sibling
+     */
+    std::chrono::seconds _downProbeInterval;
+
+    /**
+     * @brief The time to wait for the greeting
+     */
+    std::chrono::milliseconds _probeTimeout;
+
+    /**
+     * @brief Whether the sibling was reachable by the last probe
+     */
+    bool _reachable{true};
+};
+
+} // namespace data_sync::async
@@ -75,7 +75,7 @@ sdbusplus::async::task<>
             SyncDisabled();
     }
 
-    if (data_sync::Manager::isSiblingBmcNotAvailable())
+    if (_manager.isSiblingBmcNotAvailable())
     {
         lg2::error(
             "Sibling BMC is not available, Unable to retrieve the BMC IP ");
@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_journal.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+namespace data_sync::persist
+{
+
+fs::path SyncJournalFile =
+    "/var/lib/phosphor-data-sync/persistence/sync_journal";
+
+namespace
+{
+
+/**
+ * @brief The number of records after which the journal is compacted if the
+ *        trimmed records dominate.
+ */
+constexpr size_t compactThreshold = 1024;
+
+/**
+ * @brief Helper to write the whole buffer into the given file descriptor.
+ *
+ * @param[in] fd - The file descriptor
+ * @param[in] data - The data to write
+ *
+ * @return True if written; otherwise False.
+ */
+bool writeAll(int fd, std::string_view data)
+{
+    while (!data.empty())
+    {
+        auto bytes = write(fd, data.data(), data.size());
+        if (bytes < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(bytes));
+    }
+    return true;
+}
+
+/**
+ * @brief Helper to frame a record of the journal.
+ *
+ * @param[in] type - '+' for a modified path and '-' for a synced path
+ * @param[in] sequence - The sequence number of the record
+ * @param[in] path - The path of the record
+ *
+ * @return The NUL terminated record
+ */
+std::string makeRecord(char type, SyncJournal::Sequence sequence,
+                       const fs::path& path)
+{
+    std::string record(1, type);
+    record.append(std::to_string(sequence));
+    record.push_back(' ');
+    record.append(path.string());
+    record.push_back('\0');
+    return record;
+}
+
+} // namespace
+
+SyncJournal::SyncJournal(fs::path journalFile) :
+    _journalFile(std::move(journalFile))
+{}
+
+std::optional<std::vector<fs::path>> SyncJournal::load(uint64_t configId)
+{
+    _fd.reset();
+    _pendingPaths.clear();
+    _configId = configId;
+
+    std::ifstream journal(_journalFile, std::ios::binary);
+    if (!journal.is_open())
+    {
+        lg2::info("The sync journal {PATH} is not found", "PATH",
+                  _journalFile);
+        return std::nullopt;
+    }
+    std::string content{std::istreambuf_iterator<char>(journal),
+                        std::istreambuf_iterator<char>()};
+    journal.close();
+
+    auto parseRecord = [this](std::string_view record) {
+        if (record.size() < 2 || (record[0] != '+' && record[0] != '-'))
+        {
+            return false;
+        }
+
+        Sequence sequence{0};
+        auto [next, ec] = std::from_chars(record.data() + 1,
+                                          record.data() + record.size(),
+                                          sequence);
+        if (ec != std::errc{} || next == record.data() + record.size() ||
+            *next != ' ')
+        {
+            return false;
+        }
+
+        fs::path path{std::string_view{std::next(next),
+                                       record.data() + record.size()}};
+        if (!path.is_absolute())
+        {
+            return false;
+        }
+
+        if (record[0] == '+')
+        {
+            _pendingPaths[path] = sequence;
+            _sequence = std::max(_sequence, sequence);
+        }
+        else
+        {
+            erasePendingPaths(path, sequence);
+        }
+        return true;
+    };
+
+    // A torn record at the end is written without the terminating NUL, it
+    // is ignored only if it is a trim since the modified paths are flushed
+    // before their syncs are scheduled.
+    std::string_view records{content};
+    if (auto end = records.rfind('\0'); end != std::string_view::npos)
+    {
+        if (records.size() > end + 1 && records[end + 1] != '-')
+        {
+            lg2::error("The sync journal {PATH} has a torn record", "PATH",
+                       _journalFile);
+            discard();
+            return std::nullopt;
+        }
+        records = records.substr(0, end);
+    }
+    else
+    {
+        records = {};
+    }
+
+    bool isHeader{true};
+    for (auto recordRange : std::views::split(records, '\0'))
+    {
+        std::string_view record{recordRange.begin(), recordRange.end()};
+        if (isHeader)
+        {
+            isHeader = false;
+            if (record != "#" + std::to_string(configId))
+            {
+                lg2::warning("The sync journal {PATH} is not of the current "
+                             "configuration",
+                             "PATH", _journalFile);
+                discard();
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        if (!parseRecord(record))
+        {
+            lg2::error("The sync journal {PATH} is corrupt", "PATH",
+                       _journalFile);
+            discard();
+            return std::nullopt;
+        }
+    }
+
+    if (isHeader)
+    {
+        lg2::error("The sync journal {PATH} is empty", "PATH", _journalFile);
+        discard();
+        return std::nullopt;
+    }
+
+    std::vector<fs::path> pendingPaths;
+    pendingPaths.reserve(_pendingPaths.size());
+    std::ranges::copy(_pendingPaths | std::views::keys,
+                      std::back_inserter(pendingPaths));
+
+    lg2::info("Loaded the sync journal {PATH}, pending paths : {COUNT}",
+              "PATH", _journalFile, "COUNT", pendingPaths.size());
+
+    // Start with only the pending paths.
+    compact();
+    if (!isOpen())
+    {
+        return std::nullopt;
+    }
+    return pendingPaths;
+}
+
+void SyncJournal::create(uint64_t configId)
+{
+    _configId = configId;
+    _pendingPaths.clear();
+    compact();
+}
+
+void SyncJournal::discard()
+{
+    _fd.reset();
+    _pendingPaths.clear();
+    _recordCount = 0;
+
+    std::error_code ec;
+    fs::remove(_journalFile, ec);
+    if (ec)
+    {
+        lg2::error("Failed to remove the sync journal {PATH}, error: {ERROR}",
+                   "PATH", _journalFile, "ERROR", ec.message());
+    }
+}
+
+void SyncJournal::record(const std::vector<fs::path>& paths)
+{
+    if (!isOpen() || paths.empty())
+    {
+        return;
+    }
+
+    std::string records;
+    for (const auto& path : paths)
+    {
+        _pendingPaths[path] = ++_sequence;
+        records.append(makeRecord('+', _sequence, path));
+    }
+    _recordCount += paths.size();
+
+    append(records, true);
+}
+
+void SyncJournal::trim(const fs::path& syncedPath, Sequence sequence)
+{
+    if (!isOpen() || !erasePendingPaths(syncedPath, sequence))
+    {
+        return;
+    }
+
+    ++_recordCount;
+    if (!append(makeRecord('-', sequence, syncedPath), false))
+    {
+        return;
+    }
+
+    if (_recordCount >= compactThreshold &&
+        _recordCount > 2 * _pendingPaths.size())
+    {
+        compact();
+    }
+}
+
+bool SyncJournal::append(const std::string& records, bool flush)
+{
+    if (!writeAll(_fd(), records) || (flush && fdatasync(_fd()) != 0))
+    {
+        // The changes can't be tracked anymore, hence the next startup needs
+        // a full sync.
+        lg2::error("Failed to write the sync journal {PATH}, error: {ERROR}",
+                   "PATH", _journalFile, "ERROR", strerror(errno));
+        discard();
+        return false;
+    }
+    return true;
+}
+
+void SyncJournal::compact()
+{
+    _fd.reset();
+
+    std::string records{"#" + std::to_string(_configId)};
+    records.push_back('\0');
+    for (const auto& [path, sequence] : _pendingPaths)
+    {
+        records.append(makeRecord('+', sequence, path));
+    }
+
+    std::error_code ec;
+    fs::create_directories(_journalFile.parent_path(), ec);
+
+    // Write into a temporary file and rename, so that the journal is never
+    // seen partially written.
+    auto tmpFile = _journalFile;
+    tmpFile += ".tmp";
+    {
+        utility::FD tmpFd{open(tmpFile.c_str(),
+                               O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                               0644)};
+        if (tmpFd() < 0 || !writeAll(tmpFd(), records) ||
+            fdatasync(tmpFd()) != 0)
+        {
+            lg2::error("Failed to write the sync journal {PATH}, error: "
+                       "{ERROR}",
+                       "PATH", tmpFile, "ERROR", strerror(errno));
+            fs::remove(tmpFile, ec);
+            discard();
+            return;
+        }
+    }
+
+    fs::rename(tmpFile, _journalFile, ec);
+    if (!ec)
+    {
+        _fd = utility::FD{
+            open(_journalFile.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC)};
+    }
+    if (ec || !isOpen())
+    {
+        lg2::error("Failed to open the sync journal {PATH}, error: {ERROR}",
+                   "PATH", _journalFile, "ERROR",
+                   ec ? ec.message() : strerror(errno));
+        discard();
+        return;
+    }
+    _recordCount = _pendingPaths.size() + 1;
+}
+
+bool SyncJournal::erasePendingPaths(const fs::path& syncedPath,
+                                    Sequence sequence)
+{
+    return std::erase_if(_pendingPaths, [&syncedPath, sequence](
+                                            const auto& pendingPath) {
+        return pendingPath.second <= sequence &&
+               utility::isSameOrChildPath(syncedPath, pendingPath.first);
+    }) != 0;
+}
+
+} // namespace data_sync::persist
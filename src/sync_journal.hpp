@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace data_sync::persist
+{
+
+namespace fs = std::filesystem;
+
+extern fs::path SyncJournalFile;
+
+/**
+ * @class SyncJournal
+ *
+ * @brief An append only journal of the modified paths which are pending to
+ *        sync, so that only those paths are synced after a restart instead of
+ *        a full sync.
+ *
+ *        - The modified paths of a batch are recorded with a single
+ *          fdatasync() before their syncs are scheduled.
+ *        - The synced paths are trimmed without fdatasync() since a lost trim
+ *          only results in syncing the path again.
+ *        - The journal is rewritten with only the pending paths once the
+ *          trimmed records dominate.
+ *
+ *        Each record is NUL terminated, the first record is the header
+ *        "#<configId>", followed by "+<seq> <path>" for a modified path and
+ *        "-<seq> <path>" for the synced path and its sub paths recorded up to
+ *        the sequence.
+ */
+class SyncJournal
+{
+  public:
+    /**
+     * @brief The sequence number of a recorded path
+     */
+    using Sequence = uint64_t;
+
+    /**
+     * @brief Constructor
+     *
+     * The journal file is read or created only on load() or create().
+     *
+     * @param[in] journalFile - The path of the journal file
+     */
+    explicit SyncJournal(fs::path journalFile = SyncJournalFile);
+
+    /**
+     * @brief API to load the journal left by the previous run and to keep it
+     *        open for recording.
+     *
+     * @param[in] configId - The identifier of the data sync configuration,
+     *                       the journal of a different configuration is not
+     *                       loaded.
+     *
+     * @return The paths pending to sync, or std::nullopt if the journal is
+     *         missing or corrupt and the journal is discarded.
+     */
+    std::optional<std::vector<fs::path>> load(uint64_t configId);
+
+    /**
+     * @brief API to create an empty journal, once all the configured paths
+     *        are synced.
+     *
+     * @param[in] configId - The identifier of the data sync configuration
+     */
+    void create(uint64_t configId);
+
+    /**
+     * @brief API to remove the journal so that the next startup performs a
+     *        full sync.
+     */
+    void discard();
+
+    /**
+     * @brief API to check whether the journal is open for recording.
+     */
+    bool isOpen() const
+    {
+        return _fd() >= 0;
+    }
+
+    /**
+     * @brief API to record the modified paths and to flush them to the disk.
+     *
+     * Nothing is recorded if the journal is not open.
+     *
+     * @param[in] paths - The modified paths
+     */
+    void record(const std::vector<fs::path>& paths);
+
+    /**
+     * @brief Get the sequence number of the last recorded path
+     *
+     * A sync takes this before it starts so that it trims only the paths
+     * recorded before it.
+     */
+    Sequence sequence() const
+    {
+        return _sequence;
+    }
+
+    /**
+     * @brief API to trim the given synced path and its sub paths which are
+     *        recorded up to the given sequence.
+     *
+     * @param[in] syncedPath - The synced path
+     * @param[in] sequence - The sequence number taken before the sync
+     */
+    void trim(const fs::path& syncedPath, Sequence sequence);
+
+  private:
+    /**
+     * @brief API to append the given records into the journal.
+     *
+     * @param[in] records - The NUL terminated records
+     * @param[in] flush - Whether to flush the records to the disk
+     *
+     * @return True if appended; otherwise False.
+     */
+    bool append(const std::string& records, bool flush);
+
+    /**
+     * @brief API to rewrite the journal with only the pending paths.
+     */
+    void compact();
+
+    /**
+     * @brief API to remove the pending paths of the given synced path which
+     *        are recorded up to the given sequence.
+     *
+     * @param[in] syncedPath - The synced path
+     * @param[in] sequence - The sequence number taken before the sync
+     *
+     * @return True if any pending path is removed; otherwise False.
+     */
+    bool erasePendingPaths(const fs::path& syncedPath, Sequence sequence);
+
+    /**
+     * @brief The path of the journal file
+     */
+    fs::path _journalFile;
+
+    /**
+     * @brief The identifier of the data sync configuration of the journal
+     */
+    uint64_t _configId{0};
+
+    /**
+     * @brief The file descriptor of the journal opened for appending
+     */
+    utility::FD _fd{-1};
+
+    /**
+     * @brief The paths pending to sync and their last recorded sequence
+     */
+    std::map<fs::path, Sequence> _pendingPaths;
+
+    /**
+     * @brief The sequence number of the last recorded path
+     */
+    Sequence _sequence{0};
+
+    /**
+     * @brief The number of records in the journal file
+     */
+    size_t _recordCount{0};
+};
+
+} // namespace data_sync::persist
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_scheduler.hpp"
+
+#include <sys/eventfd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <experimental/scope>
+
+namespace data_sync::async
+{
+
+SyncScheduler::SyncScheduler(sdbusplus::async::context& ctx,
+                             size_t maxConcurrentSyncs) :
+    _ctx(ctx), _maxConcurrentSyncs(std::max<size_t>(maxConcurrentSyncs, 1))
+{}
+
+std::string_view SyncScheduler::getPriorityInStr(SyncPriority priority)
+{
+    switch (priority)
+    {
+        case SyncPriority::Immediate:
+            return "Immediate";
+        case SyncPriority::Notify:
+            return "Notify";
+        case SyncPriority::Periodic:
+            return "Periodic";
+        case SyncPriority::FullSync:
+            return "FullSync";
+    }
+    return "Unknown";
+}
+
+sdbusplus::async::task<SyncScheduler::Slot>
+    // NOLINTNEXTLINE
+    SyncScheduler::acquire(SyncPriority priority, fs::path cfgPath)
+{
+    using std::experimental::scope_exit;
+
+    if (!hasWaiters(priority) && hasFreeSlot(priority))
+    {
+        grant(priority, std::chrono::milliseconds{0});
+        co_return Slot{this, priority};
+    }
+
+    Waiter waiter{utility::FD{eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)},
+                  std::chrono::steady_clock::now()};
+    if (waiter._eventFd() < 0)
+    {
+        // Run beyond the limit rather than dropping the sync.
+        lg2::error("Failed to create the eventfd to wait for a sync slot for "
+                   "[{PATH}], error: {ERROR}",
+                   "PATH", cfgPath, "ERROR", strerror(errno));
+        grant(priority, std::chrono::milliseconds{0});
+        co_return Slot{this, priority};
+    }
+
+    auto& priorityClass = _classes[static_cast<size_t>(priority)];
+    auto& cfgWaiters = priorityClass._waiters[cfgPath];
+    if (cfgWaiters.empty())
+    {
+        priorityClass._rotation.emplace_back(cfgPath);
+    }
+    cfgWaiters.emplace_back(&waiter);
+    priorityClass._stats._maxQueued = std::max(
+        priorityClass._stats._maxQueued, ++priorityClass._stats._queued);
+
+    bool acquired{false};
+    auto cleanup = scope_exit([this, priority, &cfgPath, &waiter,
+                               &acquired]() noexcept {
+        // The job is cancelled while waiting or before taking the slot.
+        if (!waiter._granted)
+        {
+            dequeue(priority, cfgPath, &waiter);
+        }
+        else if (!acquired)
+        {
+            release(priority);
+        }
+    });
+
+    sdbusplus::async::fdio eventFdio(_ctx, waiter._eventFd());
+    while (!waiter._granted)
+    {
+        // NOLINTNEXTLINE
+        co_await eventFdio.next();
+    }
+
+    acquired = true;
+    co_return Slot{this, priority};
+}
+
+bool SyncScheduler::hasFreeSlot(SyncPriority priority) const
+{
+    if (_running >= _maxConcurrentSyncs)
+    {
+        return false;
+    }
+
+    if ((priority == SyncPriority::Periodic ||
+         priority == SyncPriority::FullSync) &&
+        _maxConcurrentSyncs > 1)
+    {
+        // Keep the last slot for the Immediate and Notify jobs.
+        return getStats(SyncPriority::Periodic)._running +
+                   getStats(SyncPriority::FullSync)._running <
+               _maxConcurrentSyncs - 1;
+    }
+    return true;
+}
+
+bool SyncScheduler::hasWaiters(SyncPriority priority) const
+{
+    return std::any_of(_classes.begin(),
+                       _classes.begin() + static_cast<size_t>(priority) + 1,
+                       [](const auto& priorityClass) {
+        return !priorityClass._rotation.empty();
+    });
+}
+
+void SyncScheduler::grant(SyncPriority priority,
+                          std::chrono::milliseconds waitTime)
+{
+    auto& stats = _classes[static_cast<size_t>(priority)]._stats;
+    ++_running;
+    ++stats._running;
+    ++stats._granted;
+    stats._totalWaitTime += waitTime;
+    stats._maxWaitTime = std::max(stats._maxWaitTime, waitTime);
+}
+
+void SyncScheduler::dequeue(SyncPriority priority, const fs::path& cfgPath,
+                            const Waiter* waiter)
+{
+    auto& priorityClass = _classes[static_cast<size_t>(priority)];
+    auto cfgWaiters = priorityClass._waiters.find(cfgPath);
+    if (cfgWaiters == priorityClass._waiters.end() ||
+        std::erase(cfgWaiters->second, waiter) == 0)
+    {
+        return;
+    }
+    --priorityClass._stats._queued;
+
+    if (cfgWaiters->second.empty())
+    {
+        priorityClass._waiters.erase(cfgWaiters);
+        std::erase(priorityClass._rotation, cfgPath);
+    }
+}
+
+void SyncScheduler::release(SyncPriority priority) noexcept
+{
+    --_running;
+    --_classes[static_cast<size_t>(priority)]._stats._running;
+    dispatch();
+}
+
+void SyncScheduler::dispatch() noexcept
+{
+    for (size_t index = 0;
+         index < _classes.size() && _running < _maxConcurrentSyncs; ++index)
+    {
+        const auto priority = static_cast<SyncPriority>(index);
+        auto& priorityClass = _classes[index];
+        while (!priorityClass._rotation.empty() && hasFreeSlot(priority))
+        {
+            // Serve the configurations round robin.
+            auto cfgPath = std::move(priorityClass._rotation.front());
+            priorityClass._rotation.pop_front();
+
+            auto cfgWaiters = priorityClass._waiters.find(cfgPath);
+            auto* waiter = cfgWaiters->second.front();
+            cfgWaiters->second.pop_front();
+            if (cfgWaiters->second.empty())
+            {
+                priorityClass._waiters.erase(cfgWaiters);
+            }
+            else
+            {
+                priorityClass._rotation.emplace_back(std::move(cfgPath));
+            }
+            --priorityClass._stats._queued;
+
+            auto waitTime =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - waiter->_queuedTime);
+            lg2::debug("Granted the sync slot to a {PRIORITY} job after "
+                       "waiting {WAIT_MS}ms, still queued : {QUEUED}",
+                       "PRIORITY", getPriorityInStr(priority), "WAIT_MS",
+                       waitTime.count(), "QUEUED",
+                       priorityClass._stats._queued);
+
+            waiter->_granted = true;
+            grant(priority, waitTime);
+            eventfd_write(waiter->_eventFd(), 1);
+        }
+    }
+}
+
+} // namespace data_sync::async
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <string_view>
+#include <utility>
+
+namespace data_sync::async
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The priority classes of the sync jobs, in the descending order of
+ *        the priority.
+ */
+enum class SyncPriority
+{
+    Immediate,
+    Notify,
+    Periodic,
+    FullSync
+};
+
+/**
+ * @class SyncScheduler
+ *
+ * @brief To bound the number of the rsync processes running concurrently
+ *        across all the sync jobs.
+ *
+ *        - A sync job acquires a slot before running rsync and releases it
+ *          once rsync exits, the jobs which can't get a slot wait in the
+ *          queue of their priority class.
+ *        - The queue of the highest priority class is served first, and the
+ *          jobs of the same class are served round robin across the
+ *          configurations so that a configuration with a burst of changes
+ *          can't starve the others.
+ *        - The background classes (Periodic and FullSync) can't take the
+ *          last slot, so that a running full sync can't delay the
+ *          Immediate and Notify jobs.
+ *
+ * @note The running jobs are never preempted, the reserved slot is used
+ *       instead. Killing a running rsync throws away the data transferred
+ *       so far and the killed job has to start over, while the reserved slot
+ *       bounds the wait of an Immediate or Notify job to the other jobs of
+ *       the same classes when more than one slot is configured.
+ */
+class SyncScheduler
+{
+  public:
+    SyncScheduler(const SyncScheduler&) = delete;
+    SyncScheduler& operator=(const SyncScheduler&) = delete;
+    SyncScheduler(SyncScheduler&&) = delete;
+    SyncScheduler& operator=(SyncScheduler&&) = delete;
+    ~SyncScheduler() = default;
+
+    /**
+     * @brief The statistics of a priority class to tune the concurrency.
+     */
+    struct Stats
+    {
+        /**
+         * @brief The number of the jobs which are running
+         */
+        size_t _running{0};
+
+        /**
+         * @brief The number of the jobs which are waiting for a slot
+         */
+        size_t _queued{0};
+
+        /**
+         * @brief The highest number of the jobs waited at a time
+         */
+        size_t _maxQueued{0};
+
+        /**
+         * @brief The number of the slots granted
+         */
+        size_t _granted{0};
+
+        /**
+         * @brief The total and the longest time waited for a slot
+         */
+        std::chrono::milliseconds _totalWaitTime{0};
+        std::chrono::milliseconds _maxWaitTime{0};
+    };
+
+    /**
+     * @class Slot
+     *
+     * @brief The slot to run a sync job which is released on destruction.
+     */
+    class Slot
+    {
+      public:
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot& operator=(Slot&&) = delete;
+
+        Slot(Slot&& slot) noexcept :
+            _scheduler(std::exchange(slot._scheduler, nullptr)),
+            _priority(slot._priority)
+        {}
+
+        ~Slot()
+        {
+            if (_scheduler != nullptr)
+            {
+                _scheduler->release(_priority);
+            }
+        }
+
+      private:
+        friend class SyncScheduler;
+
+        Slot(SyncScheduler* scheduler, SyncPriority priority) :
+            _scheduler(scheduler), _priority(priority)
+        {}
+
+        SyncScheduler* _scheduler;
+        SyncPriority _priority;
+    };
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] ctx - The async context object
+     * @param[in] maxConcurrentSyncs - The number of the slots
+     */
+    SyncScheduler(sdbusplus::async::context& ctx, size_t maxConcurrentSyncs);
+
+    /**
+     * @brief API to wait for a slot to run a sync job.
+     *
+     * @param[in] priority - The priority class of the job
+     * @param[in] cfgPath - The configured path of the job to share the slots
+     *                      fairly across the configurations.
+     *
+     * @return The slot which is held until the job completes
+     */
+    sdbusplus::async::task<Slot> acquire(SyncPriority priority,
+                                         fs::path cfgPath);
+
+    /**
+     * @brief Get the number of the slots
+     */
+    size_t getMaxConcurrentSyncs() const
+    {
+        return _maxConcurrentSyncs;
+    }
+
+    /**
+     * @brief Get the statistics of the given priority class
+     *
+     * @param[in] priority - The priority class
+     */
+    const Stats& getStats(SyncPriority priority) const
+    {
+        return _classes[static_cast<size_t>(priority)]._stats;
+    }
+
+    /**
+     * @brief Get the name of the given priority class
+     *
+     * @param[in] priority - The priority class
+     */
+    static std::string_view getPriorityInStr(SyncPriority priority);
+
+  private:
+    /**
+     * @brief A job waiting for a slot.
+     */
+    struct Waiter
+    {
+        /**
+         * @brief The eventfd which is signalled once the slot is granted
+         */
+        utility::FD _eventFd;
+
+        /**
+         * @brief The time at which the job started to wait
+         */
+        std::chrono::steady_clock::time_point _queuedTime;
+
+        /**
+         * @brief Whether the slot is granted to the job
+         */
+        bool _granted{false};
+    };
+
+    /**
+     * @brief The queue of a priority class.
+     */
+    struct PriorityClass
+    {
+        /**
+         * @brief The waiting jobs of each configuration
+         */
+        std::map<fs::path, std::deque<Waiter*>> _waiters;
+
+        /**
+         * @brief The configurations having waiting jobs, in the order to
+         *        serve them.
+         */
+        std::deque<fs::path> _rotation;
+
+        Stats _stats;
+    };
+
+    /**
+     * @brief API to check whether a job of the given priority class can run
+     *        now, ignoring the waiting jobs.
+     *
+     * @param[in] priority - The priority class
+     */
+    bool hasFreeSlot(SyncPriority priority) const;
+
+    /**
+     * @brief API to check whether any job of the given or a higher priority
+     *        class is waiting.
+     *
+     * @param[in] priority - The priority class
+     */
+    bool hasWaiters(SyncPriority priority) const;
+
+    /**
+     * @brief API to account the slot granted to a job of the given priority
+     *        class.
+     *
+     * @param[in] priority - The priority class
+     * @param[in] waitTime - The time the job waited for the slot
+     */
+    void grant(SyncPriority priority, std::chrono::milliseconds waitTime);
+
+    /**
+     * @brief API to remove the given job from the queue of its priority
+     *        class.
+     *
+     * @param[in] priority - The priority class
+     * @param[in] cfgPath - The configured path of the job
+     * @param[in] waiter - The waiting job
+     */
+    void dequeue(SyncPriority priority, const fs::path& cfgPath,
+                 const Waiter* waiter);
+
+    /**
+     * @brief API to release the slot of a job and to grant the free slots to
+     *        the waiting jobs.
+     *
+     * @param[in] priority - The priority class of the job
+     */
+    void release(SyncPriority priority) noexcept;
+
+    /**
+     * @brief API to grant the free slots to the waiting jobs as per the
+     *        priority and the fairness.
+     */
+    void dispatch() noexcept;
+
+    /**
+     * @brief The async context object
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief The number of the slots
+     */
+    size_t _maxConcurrentSyncs;
+
+    /**
+     * @brief The number of the jobs which are running
+     */
+    size_t _running{0};
+
+    /**
+     * @brief The queues of the priority classes, indexed by the priority
+     */
+    std::array<PriorityClass, 4> _classes;
+};
+
+} // namespace data_sync::async
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tree_digest.hpp"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace data_sync::digest
+{
+
+namespace
+{
+
+// FNV-1a, since std::hash is not guaranteed to be the same across the
+// builds.
+constexpr Digest fnvOffsetBasis = 14695981039346656037ULL;
+constexpr Digest fnvPrime = 1099511628211ULL;
+
+void hashBytes(Digest& digest, const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t index = 0; index < size; ++index)
+    {
+        digest = (digest ^ bytes[index]) * fnvPrime;
+    }
+}
+
+template <typename T>
+void hashValue(Digest& digest, const T& value)
+{
+    hashBytes(digest, &value, sizeof(value));
+}
+
+/**
+ * @brief The name and the metadata of a directory entry.
+ */
+using Entry = std::pair<std::string, struct stat>;
+
+/**
+ * @brief API to read the not excluded entries of the given directory in the
+ *        order of the names.
+ *
+ * @return The entries, std::nullopt if the directory can't be read.
+ */
+std::optional<std::vector<Entry>>
+    readEntries(const fs::path& dirPath,
+                const std::optional<config::PathMatcher>& excludeMatcher)
+{
+    std::vector<Entry> entries;
+    std::error_code ec;
+    for (const auto& dirEntry : fs::directory_iterator(dirPath, ec))
+    {
+        struct stat st{};
+        if (lstat(dirEntry.path().c_str(), &st) != 0)
+        {
+            // Vanished meanwhile
+            continue;
+        }
+        if (excludeMatcher.has_value() &&
+            excludeMatcher->matches(dirEntry.path(), S_ISDIR(st.st_mode)))
+        {
+            continue;
+        }
+        entries.emplace_back(dirEntry.path().filename().string(), st);
+    }
+    if (ec)
+    {
+        return std::nullopt;
+    }
+    std::ranges::sort(entries, {}, &Entry::first);
+    return entries;
+}
+
+void hashEntry(Digest& digest, const fs::path& dirPath, const Entry& entry)
+{
+    const auto& [name, st] = entry;
+    hashBytes(digest, name.data(), name.size() + 1);
+    hashValue(digest, st.st_mode);
+    hashValue(digest, st.st_uid);
+    hashValue(digest, st.st_gid);
+    hashValue(digest, st.st_mtim.tv_sec);
+    hashValue(digest, st.st_mtim.tv_nsec);
+    if (S_ISREG(st.st_mode))
+    {
+        hashValue(digest, st.st_size);
+    }
+    else if (S_ISLNK(st.st_mode))
+    {
+        std::error_code ec;
+        const auto target = fs::read_symlink(dirPath / name, ec).string();
+        hashBytes(digest, target.data(), target.size() + 1);
+    }
+}
+
+} // namespace
+
+TreeDigester::TreeDigester(
+    const fs::path& dirPath,
+    const std::optional<config::PathMatcher>& excludeMatcher) :
+    _dirPath(dirPath), _excludeMatcher(excludeMatcher), _walker(dirPath)
+{
+    auto entries = readEntries(_dirPath, _excludeMatcher);
+    if (!entries.has_value())
+    {
+        _failed = true;
+        return;
+    }
+
+    Digest rootDigest = fnvOffsetBasis;
+    for (const auto& entry : *entries)
+    {
+        hashEntry(rootDigest, _dirPath, entry);
+    }
+    _digests[rootKey] = rootDigest;
+}
+
+size_t TreeDigester::walk(size_t maxDirs)
+{
+    if (done())
+    {
+        return 0;
+    }
+    return _walker.walk(maxDirs, [this](const fs::path& dirPath) {
+        return digestDir(dirPath);
+    });
+}
+
+bool TreeDigester::digestDir(const fs::path& dirPath)
+{
+    if (_failed || (_excludeMatcher.has_value() &&
+                    _excludeMatcher->matches(dirPath, true)))
+    {
+        return false;
+    }
+
+    // The symbolic link to a directory is digested by its parent.
+    struct stat st{};
+    if (lstat(dirPath.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+    {
+        return false;
+    }
+
+    auto entries = readEntries(dirPath, _excludeMatcher);
+    if (!entries.has_value())
+    {
+        _failed = true;
+        return false;
+    }
+
+    const auto relativePath = dirPath.lexically_relative(_dirPath);
+    const auto relativePathStr = relativePath.string();
+
+    Digest digest = fnvOffsetBasis;
+    hashBytes(digest, relativePathStr.data(), relativePathStr.size() + 1);
+    for (const auto& entry : *entries)
+    {
+        hashEntry(digest, dirPath, entry);
+    }
+
+    // The sum is the same in whichever order the directories are walked.
+    _digests[relativePath.begin()->string()] += digest;
+    return true;
+}
+
+std::optional<SubtreeDigests> TreeDigester::getSubtreeDigests() const
+{
+    if (_failed || !_walker.done())
+    {
+        return std::nullopt;
+    }
+    return _digests;
+}
+
+std::optional<Digest> TreeDigester::getTreeDigest() const
+{
+    if (_failed || !_walker.done())
+    {
+        return std::nullopt;
+    }
+
+    Digest digest = fnvOffsetBasis;
+    for (const auto& [subtree, subtreeDigest] : _digests)
+    {
+        hashBytes(digest, subtree.data(), subtree.size() + 1);
+        hashValue(digest, subtreeDigest);
+    }
+    return digest;
+}
+
+std::optional<SubtreeDigests> getSubtreeDigests(
+    const fs::path& dirPath,
+    const std::optional<config::PathMatcher>& excludeMatcher)
+{
+    TreeDigester digester(dirPath, excludeMatcher);
+    digester.walk(std::numeric_limits<size_t>::max());
+    return digester.getSubtreeDigests();
+}
+
+Digest getPathDigest(const fs::path& path,
+                     const std::optional<Digest>& treeDigest)
+{
+    Digest digest = fnvOffsetBasis;
+    struct stat st{};
+    if (lstat(path.c_str(), &st) != 0)
+    {
+        // The missing path keeps the initial digest.
+        return digest;
+    }
+
+    hashEntry(digest, path.parent_path(), {path.filename().string(), st});
+    if (S_ISDIR(st.st_mode) && treeDigest.has_value())
+    {
+        hashValue(digest, *treeDigest);
+    }
+    return digest;
+}
+
+} // namespace data_sync::digest
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "dir_walker.hpp"
+#include "path_matcher.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace data_sync::digest
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief The digest of the metadata of a directory tree.
+ */
+using Digest = uint64_t;
+
+/**
+ * @brief The digests of the top level subtrees of a directory keyed by the
+ *        name of the subdirectory, and by rootKey for the top level entries.
+ */
+using SubtreeDigests = std::map<std::string, Digest>;
+
+/**
+ * @brief The key of the digest of the top level entries.
+ */
+constexpr auto rootKey = ".";
+
+/**
+ * @class TreeDigester
+ *
+ * @brief To compute the digests of the top level subtrees of a directory in
+ *        bounded slices, so that a huge tree can be digested without
+ *        blocking the caller for the whole tree.
+ *
+ *        - The digest of a directory combines its path relative to the
+ *          digested directory and the name, the type, the permissions, the
+ *          owner, the group, the size and the modification time of its
+ *          entries in the order of the names, hence it changes if anything
+ *          which rsync syncs is changed in the directory.
+ *        - The digest of a subtree is the sum of the digests of its
+ *          directories, hence it doesn't depend on the order of the walk.
+ *        - The digest of the top level entries covers the attributes of the
+ *          subdirectories but not their content.
+ *        - The symbolic links are not followed, their targets are digested.
+ *        - The excluded paths are not part of the digests.
+ */
+class TreeDigester
+{
+  public:
+    /**
+     * @brief Constructor
+     *
+     * Digests the top level entries of the directory.
+     *
+     * @param[in] dirPath - The directory
+     * @param[in] excludeMatcher - The excluded paths, if any, which must
+     *                             outlive the object.
+     */
+    TreeDigester(const fs::path& dirPath,
+                 const std::optional<config::PathMatcher>& excludeMatcher);
+
+    /**
+     * @brief API to digest the next slice of the directories of the tree.
+     *
+     * @param[in] maxDirs - The maximum number of directories to digest
+     *
+     * @return The number of visited directories
+     */
+    size_t walk(size_t maxDirs);
+
+    /**
+     * @brief API to check whether the whole tree is digested or digesting
+     *        is failed.
+     */
+    bool done() const
+    {
+        return _failed || _walker.done();
+    }
+
+    /**
+     * @brief API to get the digests of the top level subtrees.
+     *
+     * @return The digests, std::nullopt if the tree is not digested yet or
+     *         any directory of the tree can't be read.
+     */
+    std::optional<SubtreeDigests> getSubtreeDigests() const;
+
+    /**
+     * @brief API to get the digest of the whole tree, which combines the
+     *        digests of the top level subtrees.
+     *
+     * @return The digest, std::nullopt if the tree is not digested yet or
+     *         any directory of the tree can't be read.
+     */
+    std::optional<Digest> getTreeDigest() const;
+
+  private:
+    /**
+     * @brief API to digest the given directory into its subtree.
+     *
+     * @param[in] dirPath - The directory visited by the walk
+     *
+     * @return True to descend into the directory; otherwise False.
+     */
+    bool digestDir(const fs::path& dirPath);
+
+    /**
+     * @brief The directory to digest
+     */
+    fs::path _dirPath;
+
+    /**
+     * @brief The excluded paths, if any
+     */
+    const std::optional<config::PathMatcher>& _excludeMatcher;
+
+    /**
+     * @brief To walk the subdirectories in slices
+     */
+    utility::DirWalker _walker;
+
+    /**
+     * @brief Indicates a directory of the tree can't be read
+     */
+    bool _failed{false};
+
+    /**
+     * @brief The digests computed so far
+     */
+    SubtreeDigests _digests;
+};
+
+/**
+ * @brief API to compute the digests of the top level subtrees of the given
+ *        directory in one go, see TreeDigester.
+ *
+ * @param[in] dirPath - The directory
+ * @param[in] excludeMatcher - The excluded paths, if any
+ *
+ * @return The digests, std::nullopt if any directory of the tree can't be
+ *         read.
+ */
+std::optional<SubtreeDigests> getSubtreeDigests(
+    const fs::path& dirPath,
+    const std::optional<config::PathMatcher>& excludeMatcher);
+
+/**
+ * @brief API to compute the digest of the given path.
+ *
+ *        - The digest is of the same metadata as TreeDigester, which is
+ *          cheap to check whether anything to sync is changed.
+ *        - A missing path has a digest too, so that its removal is a
+ *          change.
+ *
+ * @param[in] path - The file or directory
+ * @param[in] treeDigest - The digest of the whole tree from TreeDigester if
+ *                         the path is a directory
+ *
+ * @return The digest
+ */
+Digest getPathDigest(const fs::path& path,
+                     const std::optional<Digest>& treeDigest);
+
+} // namespace data_sync::digest
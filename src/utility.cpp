@@ -8,8 +8,14 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <regex>
+#include <sstream>
+#include <string_view>
 #include <utility>
 
 namespace data_sync::utility
@@ -95,6 +101,60 @@ void setupPaths()
     }
 }
 
+bool raiseQueuedEventsLimit(const fs::path& sysctlPath)
+{
+    uint64_t currentLimit{0};
+    std::ifstream(sysctlPath) >> currentLimit;
+    if (currentLimit == 0)
+    {
+        lg2::error("Failed to read the queued events limit from {PATH}",
+                   "PATH", sysctlPath);
+        return false;
+    }
+
+    const uint64_t maxLimit = MAX_QUEUED_EVENTS_LIMIT;
+    if (currentLimit >= maxLimit)
+    {
+        lg2::warning("The queued events limit {LIMIT} in {PATH} is already at "
+                     "the maximum",
+                     "LIMIT", currentLimit, "PATH", sysctlPath);
+        return false;
+    }
+
+    const auto newLimit = std::min(currentLimit * 2, maxLimit);
+    std::ofstream sysctlFile(sysctlPath);
+    sysctlFile << newLimit;
+    sysctlFile.close();
+    if (sysctlFile.fail())
+    {
+        lg2::error("Failed to raise the queued events limit in {PATH}", "PATH",
+                   sysctlPath);
+        return false;
+    }
+
+    lg2::info("Raised the queued events limit in {PATH} from {OLD} to {NEW}",
+              "PATH", sysctlPath, "OLD", currentLimit, "NEW", newLimit);
+    return true;
+}
+
+bool isSameOrChildPath(const fs::path& basePath, const fs::path& path)
+{
+    // The directory paths can have the trailing slash which is an empty
+    // component at the end.
+    auto [baseItr, pathItr] = std::ranges::mismatch(basePath, path);
+    return (baseItr == basePath.end()) ||
+           (baseItr->empty() && std::next(baseItr) == basePath.end());
+}
+
+uint64_t getStableHash(std::string_view data, uint64_t hash)
+{
+    for (const auto byte : data)
+    {
+        hash = (hash ^ static_cast<uint8_t>(byte)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
 namespace rsync
 {
 
@@ -110,5 +170,84 @@ size_t getTransferredDataBytes(const std::string& rsyncOpStr)
     }
     return 0;
 }
+
+size_t getTotalFileSizeBytes(const std::string& rsyncOpStr)
+{
+    // Regex to capture the numeric value of "Total file size:"
+    std::regex re(R"(Total file size:\s*([0-9,]+))");
+    std::smatch match;
+
+    if (std::regex_search(rsyncOpStr, match, re))
+    {
+        auto size = match[1].str();
+        std::erase(size, ',');
+        return static_cast<size_t>(std::stoull(size));
+    }
+    return 0;
+}
+
+size_t getTransferredFilesCount(const std::string& rsyncOpStr)
+{
+    // Regex to capture the numeric value of
+    // "Number of regular files transferred:"
+    std::regex re(R"(Number of regular files transferred:\s*([0-9,]+))");
+    std::smatch match;
+
+    if (std::regex_search(rsyncOpStr, match, re))
+    {
+        auto count = match[1].str();
+        std::erase(count, ',');
+        return static_cast<size_t>(std::stoull(count));
+    }
+    return 0;
+}
+
+size_t getTransferredFileSizeBytes(const std::string& rsyncOpStr)
+{
+    // Regex to capture the numeric value of "Total transferred file size:"
+    std::regex re(R"(Total transferred file size:\s*([0-9,]+))");
+    std::smatch match;
+
+    if (std::regex_search(rsyncOpStr, match, re))
+    {
+        auto size = match[1].str();
+        std::erase(size, ',');
+        return static_cast<size_t>(std::stoull(size));
+    }
+    return 0;
+}
+
+std::vector<std::filesystem::path>
+    getTransferredPaths(const std::string& rsyncOpStr)
+{
+    constexpr std::string_view itemPrefix{"Item: "};
+    // The itemized changes are 11 characters, Eg: ">f+++++++++", followed by
+    // a space and the name.
+    constexpr size_t itemizeLength = 11;
+    constexpr size_t nameOffset = itemPrefix.size() + itemizeLength + 1;
+
+    std::vector<std::filesystem::path> paths;
+    std::istringstream output(rsyncOpStr);
+    std::string line;
+    while (std::getline(output, line))
+    {
+        if (!line.starts_with(itemPrefix) || line.size() <= nameOffset)
+        {
+            continue;
+        }
+        const auto updateType = line[itemPrefix.size()];
+        if (updateType != '<' && updateType != '>')
+        {
+            continue;
+        }
+        auto name = line.substr(nameOffset);
+        if (name.ends_with('/'))
+        {
+            name.pop_back();
+        }
+        paths.emplace_back(std::move(name));
+    }
+    return paths;
+}
 } // namespace rsync
 } // namespace data_sync::utility
@@ -3,7 +3,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <string>
+#include <string_view>
+#include <vector>
+
 namespace data_sync::utility
 {
 
@@ -67,6 +72,44 @@ class FD
  */
 void setupPaths();
 
+/**
+ * @brief Raise the kernel limit of the queued events of a notification
+ *        instance after its queue overflowed.
+ *
+ * The limit is doubled until MAX_QUEUED_EVENTS_LIMIT. The kernel applies the
+ * limit to the notification instances created afterwards.
+ *
+ * @param[in] sysctlPath - The sysctl file of the limit,
+ *                         Eg: /proc/sys/fs/inotify/max_queued_events
+ *
+ * @return True if the limit is raised; otherwise False.
+ */
+bool raiseQueuedEventsLimit(const std::filesystem::path& sysctlPath);
+
+/**
+ * @brief API to check whether the given path is same as or inside the
+ *        given base path, compared component wise.
+ *
+ * @param[in] basePath - The base path
+ * @param[in] path - The path to check
+ *
+ * @return True if the path is same or inside; otherwise False.
+ */
+bool isSameOrChildPath(const std::filesystem::path& basePath,
+                       const std::filesystem::path& path);
+
+/**
+ * @brief API to hash the given data by FNV-1a, which unlike std::hash is
+ *        the same across the builds and hence can be persisted.
+ *
+ * @param[in] data - The data to hash
+ * @param[in] hash - The hash to continue from, to hash several data
+ *
+ * @return The hash of the data
+ */
+uint64_t getStableHash(std::string_view data,
+                       uint64_t hash = 14695981039346656037ULL);
+
 namespace rsync
 {
 /**
@@ -83,5 +126,69 @@ namespace rsync
  */
 size_t getTransferredDataBytes(const std::string& rsyncOpStr);
 
+/**
+ * @brief Extract the total size of the files considered by rsync
+ *
+ * The function searches the provided rsync log string for the line
+ * starting with "Total file size:" and captures its numeric value
+ * ignoring the thousands separators.
+ *
+ * @param[in] rsyncOpStr - rsync output string containing the transfer
+ *                         summary.
+ * @return size_t - numeric value of the total file size
+ *                - Returns 0 if the value is not found
+ */
+size_t getTotalFileSizeBytes(const std::string& rsyncOpStr);
+
+/**
+ * @brief Extract the number of the regular files transferred
+ *
+ * The function searches the provided rsync log string for the line
+ * starting with "Number of regular files transferred:" and captures its
+ * numeric value ignoring the thousands separators.
+ *
+ * @param[in] rsyncOpStr - rsync output string containing the transfer
+ *                         summary.
+ * @return size_t - numeric value of the transferred files count
+ *                - Returns 0 if the value is not found
+ */
+size_t getTransferredFilesCount(const std::string& rsyncOpStr);
+
+/**
+ * @brief Extract the total size of the files transferred
+ *
+ * The function searches the provided rsync log string for the line
+ * starting with "Total transferred file size:" and captures its numeric
+ * value ignoring the thousands separators. Unlike "Literal data:", this is
+ * reported by the dry-run as well.
+ *
+ * @param[in] rsyncOpStr - rsync output string containing the transfer
+ *                         summary.
+ * @return size_t - numeric value of the transferred files size
+ *                - Returns 0 if the value is not found
+ */
+size_t getTransferredFileSizeBytes(const std::string& rsyncOpStr);
+
+/**
+ * @brief The rsync option to report each changed item with its itemized
+ *        changes, which is parsed by getTransferredPaths().
+ */
+constexpr std::string_view itemizeOutFormat{"--out-format=Item: %i %n"};
+
+/**
+ * @brief Extract the paths whose data is transferred
+ *
+ * The function parses the lines reported as per itemizeOutFormat and
+ * captures the names of the items whose update type is a transfer ('<' or
+ * '>'), hence the deletions and the attribute only changes are skipped.
+ *
+ * @param[in] rsyncOpStr - rsync output string containing the itemized
+ *                         changes.
+ * @return The transferred paths as reported by rsync, that is relative to
+ *         the transfer root.
+ */
+std::vector<std::filesystem::path>
+    getTransferredPaths(const std::string& rsyncOpStr);
+
 } // namespace rsync
 } // namespace data_sync::utility
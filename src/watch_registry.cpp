@@ -0,0 +1,529 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "watch_registry.hpp"
+
+#include "data_watcher.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+
+namespace data_sync::watch::inotify
+{
+
+WatchRegistry::WatchRegistry(sdbusplus::async::context& ctx,
+                             const int inotifyFlags) :
+    _ctx(ctx), _inotifyFlags(inotifyFlags),
+    _inotifyFileDescriptor(inotifyInit()),
+    _fdioInstance(std::make_unique<sdbusplus::async::fdio>(
+        ctx, _inotifyFileDescriptor())),
+    _eventBuffer(eventBufferSize)
+{}
+
+WatchRegistry::~WatchRegistry()
+{
+    if (_inotifyFileDescriptor() >= 0)
+    {
+        std::ranges::for_each(_watches, [this](const auto& watch) {
+            if (watch._wd >= 0)
+            {
+                inotify_rm_watch(_inotifyFileDescriptor(), watch._wd);
+            }
+        });
+    }
+}
+
+int WatchRegistry::inotifyInit() const
+{
+    auto fd = inotify_init1(_inotifyFlags);
+
+    if (-1 == fd)
+    {
+        lg2::error("inotify_init1 call failed with ErrNo : {ERRNO}, ErrMsg : "
+                   "{ERRMSG}",
+                   "ERRNO", errno, "ERRMSG", strerror(errno));
+
+        // TODO: Throw meaningful exception
+        throw std::runtime_error("inotify_init1 failed");
+    }
+    return fd;
+}
+
+WD WatchRegistry::addWatch(const fs::path& pathToWatch,
+                           uint32_t eventMasksToWatch, DataWatcher* subscriber)
+{
+    // IN_MASK_ADD to keep the events of the other subscribers if the inode is
+    // already watched.
+    auto wd = inotify_add_watch(_inotifyFileDescriptor(), pathToWatch.c_str(),
+                                eventMasksToWatch | IN_MASK_ADD);
+    if (-1 == wd)
+    {
+        lg2::error(
+            "inotify_add_watch call failed for {PATH} with ErrNo : {ERRNO}, "
+            "ErrMsg : {ERRMSG}",
+            "PATH", pathToWatch, "ERRNO", errno, "ERRMSG", strerror(errno));
+        // TODO: create error log ? bcoz not watching the  path
+        throw std::runtime_error("Failed to add to watch list");
+    }
+
+    if (auto slot = getSlot(wd); slot.has_value())
+    {
+        auto& watch = _watches[*slot];
+        if (!std::ranges::contains(watch._subscribers, subscriber))
+        {
+            watch._subscribers.emplace_back(subscriber);
+        }
+        lg2::debug("Reusing the watch of {PATH} for {NEWPATH}, wd : {WD}, "
+                   "subscribers : {COUNT}",
+                   "PATH", getPath(wd), "NEWPATH", pathToWatch, "WD", wd,
+                   "COUNT", watch._subscribers.size());
+        return wd;
+    }
+
+    Watch watch{};
+    watch._wd = wd;
+    watch._subscribers.emplace_back(subscriber);
+
+    // A single stat gives both the file type and the inode of the path.
+    struct stat pathStat{};
+    if (stat(pathToWatch.c_str(), &pathStat) == 0)
+    {
+        watch._isDir = S_ISDIR(pathStat.st_mode);
+        watch._inode = InodeKey{pathStat.st_dev, pathStat.st_ino};
+    }
+
+    linkToParent(watch, pathToWatch);
+
+    size_t slot = _watches.size();
+    if (!_freeSlots.empty())
+    {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _watches[slot] = std::move(watch);
+    }
+    else
+    {
+        _watches.emplace_back(std::move(watch));
+    }
+
+    if (static_cast<size_t>(wd) >= _slotIndex.size())
+    {
+        _slotIndex.resize(static_cast<size_t>(wd) + 1, 0);
+    }
+    _slotIndex[wd] = static_cast<uint32_t>(slot + 1);
+
+    if (_watches[slot]._inode.has_value())
+    {
+        _inodeIndex.insert_or_assign(*_watches[slot]._inode, wd);
+    }
+    return wd;
+}
+
+void WatchRegistry::removeWatch(WD wd, DataWatcher* subscriber)
+{
+    auto slot = getSlot(wd);
+    if (!slot.has_value())
+    {
+        return;
+    }
+
+    auto& subscribers = _watches[*slot]._subscribers;
+    std::erase(subscribers, subscriber);
+    if (subscribers.empty())
+    {
+        // The events of the removed subscribers are filtered by the remaining
+        // subscribers, hence the watch is removed only for the last one.
+        inotify_rm_watch(_inotifyFileDescriptor(), wd);
+        releaseWatch(wd);
+    }
+}
+
+void WatchRegistry::moveWatch(WD wd, const fs::path& newPath)
+{
+    auto slot = getSlot(wd);
+    if (!slot.has_value())
+    {
+        return;
+    }
+
+    auto& watch = _watches[*slot];
+    if (auto parentSlot = getSlot(watch._parentWd); parentSlot.has_value())
+    {
+        --_watches[*parentSlot]._childCount;
+    }
+    linkToParent(watch, newPath);
+
+    lg2::debug("Moved the watch of wd : {WD} to {PATH}", "WD", wd, "PATH",
+               newPath);
+}
+
+void WatchRegistry::linkToParent(Watch& watch, const fs::path& pathToWatch)
+{
+    std::string pathStr = pathToWatch.string();
+    while (pathStr.size() > 1 && pathStr.back() == '/')
+    {
+        pathStr.pop_back();
+    }
+    fs::path path{pathStr};
+
+    // Store only the basename if the parent directory is watched with the
+    // same path, otherwise store the absolute path.
+    watch._parentWd = -1;
+    watch._name = pathStr;
+    if (auto parentWd = findWatch(path.parent_path());
+        parentWd.has_value() && *parentWd != watch._wd &&
+        buildPath(*getSlot(*parentWd)) == path.parent_path().string())
+    {
+        watch._parentWd = *parentWd;
+        watch._name = path.filename().string();
+        ++_watches[*getSlot(*parentWd)]._childCount;
+    }
+}
+
+void WatchRegistry::handleQueueOverflow(
+    std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents)
+{
+    lg2::error("The inotify event queue overflowed, events are lost for "
+               "{COUNT} watches",
+               "COUNT", watchCount());
+
+    utility::raiseQueuedEventsLimit(queuedEventsLimitPath);
+
+    // The lost events could be of any watch, hence all the subscribers are
+    // notified.
+    std::set<DataWatcher*> subscribers;
+    for (const auto& watch : _watches)
+    {
+        subscribers.insert(watch._subscribers.begin(),
+                           watch._subscribers.end());
+    }
+    for (auto* subscriber : subscribers)
+    {
+        receivedEvents[subscriber].emplace_back(-1, "", IN_Q_OVERFLOW, 0);
+    }
+}
+
+std::optional<size_t> WatchRegistry::getSlot(WD wd) const
+{
+    if (wd < 0 || static_cast<size_t>(wd) >= _slotIndex.size() ||
+        _slotIndex[wd] == 0)
+    {
+        return std::nullopt;
+    }
+    return _slotIndex[wd] - 1;
+}
+
+const std::string& WatchRegistry::buildPath(size_t slot) const
+{
+    _pathComponents.clear();
+    for (std::optional<size_t> current = slot; current.has_value();
+         current = getSlot(_watches[*current]._parentWd))
+    {
+        _pathComponents.emplace_back(&_watches[*current]._name);
+    }
+
+    _pathBuffer.clear();
+    for (const auto* component : _pathComponents | std::views::reverse)
+    {
+        if (!_pathBuffer.empty() && _pathBuffer.back() != '/')
+        {
+            _pathBuffer += '/';
+        }
+        _pathBuffer += *component;
+    }
+    return _pathBuffer;
+}
+
+fs::path WatchRegistry::getPath(WD wd) const
+{
+    auto slot = getSlot(wd);
+    if (!slot.has_value())
+    {
+        throw std::out_of_range("The watch descriptor is not watched");
+    }
+
+    const auto& path = buildPath(*slot);
+    if (_watches[*slot]._isDir && path.back() != '/')
+    {
+        return fs::path(path) / "";
+    }
+    return path;
+}
+
+std::optional<WD> WatchRegistry::findWatch(const fs::path& path) const
+{
+    struct stat pathStat{};
+    if (stat(path.c_str(), &pathStat) != 0)
+    {
+        return std::nullopt;
+    }
+
+    if (auto watch = _inodeIndex.find({pathStat.st_dev, pathStat.st_ino});
+        watch != _inodeIndex.end())
+    {
+        return watch->second;
+    }
+    return std::nullopt;
+}
+
+void WatchRegistry::releaseWatch(WD wd)
+{
+    auto slot = getSlot(wd);
+    if (!slot.has_value())
+    {
+        return;
+    }
+
+    if (_watches[*slot]._childCount != 0)
+    {
+        for (auto& child : _watches)
+        {
+            if (child._wd >= 0 && child._parentWd == wd)
+            {
+                child._name = buildPath(*getSlot(child._wd));
+                child._parentWd = -1;
+            }
+        }
+    }
+
+    auto& watch = _watches[*slot];
+    if (auto parentSlot = getSlot(watch._parentWd); parentSlot.has_value())
+    {
+        --_watches[*parentSlot]._childCount;
+    }
+    if (watch._inode.has_value())
+    {
+        if (auto inode = _inodeIndex.find(*watch._inode);
+            inode != _inodeIndex.end() && inode->second == wd)
+        {
+            _inodeIndex.erase(inode);
+        }
+    }
+
+    watch = Watch{};
+    _freeSlots.emplace_back(*slot);
+    _slotIndex[wd] = 0;
+    while (!_slotIndex.empty() && _slotIndex.back() == 0)
+    {
+        _slotIndex.pop_back();
+    }
+}
+
+// NOLINTNEXTLINE
+sdbusplus::async::task<> WatchRegistry::onEvents()
+{
+    std::map<DataWatcher*, std::vector<EventInfo>> receivedEvents;
+
+    // A blocking inotify instance can't be read without waiting, hence its
+    // events are read only after all the pending watches are added.
+    const bool nonBlocking = (_inotifyFlags & IN_NONBLOCK) != 0;
+    while (hasPendingWatches())
+    {
+        addPendingWatches();
+
+        if (nonBlocking)
+        {
+            readEvents(receivedEvents);
+            if (!receivedEvents.empty())
+            {
+                dispatchEvents(receivedEvents);
+                co_return;
+            }
+        }
+
+        if (hasPendingWatches())
+        {
+            // Yield to let the other coroutines run
+            // NOLINTNEXTLINE
+            co_await sdbusplus::async::sleep_for(_ctx,
+                                                 std::chrono::milliseconds(0));
+        }
+    }
+
+    // NOLINTNEXTLINE
+    co_await _fdioInstance->next();
+
+    readEvents(receivedEvents);
+    dispatchEvents(receivedEvents);
+    co_return;
+}
+
+void WatchRegistry::dispatchEvents(
+    std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents)
+{
+    // The subscribers may add or remove watches while processing, hence
+    // dispatched only after all the events are parsed.
+    for (auto& [subscriber, events] : receivedEvents)
+    {
+        try
+        {
+            subscriber->processEvents(events);
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error("Failed to process the inotify events for {PATH}. "
+                       "Exception : {ERROR}",
+                       "PATH", subscriber->getDataPathToWatch(), "ERROR",
+                       e.what());
+        }
+    }
+
+    // The paths of the watches removed by the kernel are required by the
+    // subscribers to process the events, hence released only now.
+    std::ranges::for_each(_ignoredWatches,
+                          [this](const WD wd) { releaseWatch(wd); });
+    _ignoredWatches.clear();
+}
+
+void WatchRegistry::schedulePendingWatches(DataWatcher* subscriber)
+{
+    if (!std::ranges::contains(_pendingSubscribers, subscriber))
+    {
+        _pendingSubscribers.emplace_back(subscriber);
+    }
+}
+
+void WatchRegistry::cancelPendingWatches(DataWatcher* subscriber)
+{
+    std::erase(_pendingSubscribers, subscriber);
+}
+
+void WatchRegistry::addPendingWatches()
+{
+    size_t budget = watchSetupSliceSize;
+    while (budget > 0 && hasPendingWatches())
+    {
+        auto* subscriber = _pendingSubscribers.front();
+        try
+        {
+            budget -= subscriber->addPendingWatches(budget);
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error("Failed to add the pending watches for {PATH}. "
+                       "Exception : {ERROR}",
+                       "PATH", subscriber->getDataPathToWatch(), "ERROR",
+                       e.what());
+            subscriber->_pendingWalks.clear();
+        }
+
+        if (!subscriber->hasPendingWatches())
+        {
+            _pendingSubscribers.pop_front();
+        }
+    }
+    lg2::debug("Added a slice of the pending watches, total watches : "
+               "{COUNT}, pending subscribers : {PENDING}",
+               "COUNT", watchCount(), "PENDING", _pendingSubscribers.size());
+}
+
+void WatchRegistry::readEvents(
+    std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents)
+{
+    // Keep reading until the queue is empty so that a burst of events is
+    // returned as one batch instead of one reactor wakeup per event.
+    // A blocking inotify instance is read only once, since the next read
+    // would wait for the new events.
+    const bool drainQueue = (_inotifyFlags & IN_NONBLOCK) != 0;
+
+    do
+    {
+        // Retry the interrupted read explicitly, the loop condition doesn't
+        // retry it for a blocking inotify instance.
+        ssize_t bytes{-1};
+        do
+        {
+            bytes = read(_inotifyFileDescriptor(), _eventBuffer.data(),
+                         _eventBuffer.size());
+        } while (0 > bytes && errno == EINTR);
+
+        if (0 > bytes)
+        {
+            // In non blocking mode, read returns immediately with EAGAIN /
+            // EWOULDBLOCK when no data is available, instead of waiting.
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                lg2::error("Failed to read inotify event, error: {ERROR}",
+                           "ERROR", strerror(errno));
+            }
+            break;
+        }
+        if (0 == bytes)
+        {
+            break;
+        }
+
+        parseEvents(std::span<const uint8_t>(_eventBuffer.data(),
+                                             static_cast<size_t>(bytes)),
+                    receivedEvents);
+    } while (drainQueue);
+}
+
+void WatchRegistry::parseEvents(
+    std::span<const uint8_t> buffer,
+    std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents)
+{
+    size_t offset = 0;
+    while (offset < buffer.size())
+    {
+        // NOLINTNEXTLINE to avoid cppcoreguidelines-pro-type-reinterpret-cast
+        const auto* receivedEvent = reinterpret_cast<const inotify_event*>(
+            &buffer[offset]);
+        offset += offsetof(inotify_event, name) + receivedEvent->len;
+
+        if (receivedEvent->wd == -1 &&
+            (receivedEvent->mask & IN_Q_OVERFLOW) != 0)
+        {
+            handleQueueOverflow(receivedEvents);
+            continue;
+        }
+
+        // The slot may not be found since IN_IGNORED and the other queued
+        // events can arrive for already removed watch descriptors.
+        auto slot = getSlot(receivedEvent->wd);
+        if (!slot.has_value())
+        {
+            lg2::debug("Received {EVENTS} from [removed path], wd:{WD} and "
+                       "name : {NAME}",
+                       "EVENTS", DataWatcher::eventName(receivedEvent->mask),
+                       "WD", receivedEvent->wd, "NAME",
+                       receivedEvent->len != 0 ? receivedEvent->name : "");
+            continue;
+        }
+
+        // The path is built only by the interested subscribers, so only the
+        // wd is logged here.
+        lg2::debug("Received {EVENTS} from wd:{WD} and name : {NAME}",
+                   "EVENTS", DataWatcher::eventName(receivedEvent->mask), "WD",
+                   receivedEvent->wd, "NAME",
+                   receivedEvent->len != 0 ? receivedEvent->name : "");
+
+        for (auto* subscriber : _watches[*slot]._subscribers)
+        {
+            if (subscriber->isInterestedEvent(receivedEvent->mask))
+            {
+                receivedEvents[subscriber].emplace_back(
+                    receivedEvent->wd,
+                    receivedEvent->len != 0 ? receivedEvent->name : "",
+                    receivedEvent->mask, receivedEvent->cookie);
+            }
+        }
+
+        // The kernel removed the watch as the path is deleted or unmounted.
+        if ((receivedEvent->mask & IN_IGNORED) != 0)
+        {
+            _ignoredWatches.emplace_back(receivedEvent->wd);
+        }
+    }
+}
+
+} // namespace data_sync::watch::inotify
@@ -0,0 +1,468 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <sys/inotify.h>
+#include <sys/types.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace data_sync::watch::inotify
+{
+
+namespace fs = std::filesystem;
+namespace utility = data_sync::utility;
+
+/**
+ * @brief A tuple which has the info related to the occured inotify event
+ *
+ * int         - Watch descriptor corresponds to the event
+ * std::string - name[] in inotify_event struct
+ * uint32_t    - Mask describing event
+ */
+using WD = int;
+using BaseName = std::string;
+using EventMask = uint32_t;
+using Cookie = uint32_t;
+using EventInfo = std::tuple<WD, BaseName, EventMask, Cookie>;
+
+class DataWatcher;
+
+/**
+ * @class WatchRegistry
+ *
+ * @brief The registry of the inotify watches shared by the DataWatcher
+ *        instances.
+ *
+ *        - A single inotify instance and fdio is used for all the registered
+ *          DataWatcher instances.
+ *        - The kernel returns the same watch descriptor for the same inode
+ *          within an inotify instance, hence a watch is placed only once per
+ *          unique directory or file and reference counted by its subscribers.
+ *        - The events are dispatched to the subscribers of the watch
+ *          descriptor and each subscriber applies its own filters.
+ *        - The watches are kept in a dense table indexed by the watch
+ *          descriptor which stores only the basename and the parent watch of
+ *          each path, the full path is rebuilt on demand.
+ *        - An inode to watch descriptor index gives the watch of an existing
+ *          path without comparing it against all the watched paths.
+ *        - Upon the queue overflow, all the subscribers are notified with
+ *          IN_Q_OVERFLOW since the lost events could be of any watch.
+ *        - The watches of the sub directories requested by the subscribers
+ *          are added in bounded slices which yield back to the async context,
+ *          so that a huge tree doesn't block the other coroutines.
+ */
+class WatchRegistry
+{
+  public:
+    WatchRegistry(const WatchRegistry&) = delete;
+    WatchRegistry& operator=(const WatchRegistry&) = delete;
+    WatchRegistry(WatchRegistry&&) = delete;
+    WatchRegistry& operator=(WatchRegistry&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * Initializes the inotify instance.
+     *
+     * @param[in] ctx - The async context object
+     * @param[in] inotifyFlags - inotify flags to initialize the instance
+     */
+    WatchRegistry(sdbusplus::async::context& ctx, int inotifyFlags);
+
+    /**
+     * @brief Destructor
+     * Remove all the inotify watches
+     */
+    ~WatchRegistry();
+
+    /**
+     * @brief API to add the watch for the given path on behalf of the given
+     *        subscriber.
+     *
+     *        - The interested events are added to the existing events of the
+     *          watch if the path is already watched by another subscriber.
+     *
+     * @param[in] pathToWatch - The path of file/directory to be monitored
+     * @param[in] eventMasksToWatch - The set of events for which the path to be
+     *                                monitored
+     * @param[in] subscriber - The DataWatcher which requires the watch
+     *
+     * @return The watch descriptor of the path
+     *
+     * @note Throws std::runtime_error on failure.
+     */
+    WD addWatch(const fs::path& pathToWatch, uint32_t eventMasksToWatch,
+                DataWatcher* subscriber);
+
+    /**
+     * @brief API to remove the given subscriber from the watch and to remove
+     *        the watch if there are no more subscribers.
+     *
+     * @param[in] wd - Watch descriptor corresponding to the path
+     * @param[in] subscriber - The DataWatcher which no longer requires the
+     *                         watch
+     */
+    void removeWatch(WD wd, DataWatcher* subscriber);
+
+    /**
+     * @brief API to update the path of the given watch once the watched
+     *        path is renamed or moved.
+     *
+     *        - The kernel keeps the watches of a moved directory and its sub
+     *          directories, and their paths are rebuilt from the moved
+     *          directory.
+     *
+     * @param[in] wd - Watch descriptor of the moved path
+     * @param[in] newPath - The new path
+     */
+    void moveWatch(WD wd, const fs::path& newPath);
+
+    /**
+     * @brief API to check whether the given watch descriptor is watched.
+     *
+     * @param[in] wd - Watch descriptor to check
+     *
+     * @return True if watched; otherwise False.
+     */
+    bool isWatching(WD wd) const
+    {
+        return getSlot(wd).has_value();
+    }
+
+    /**
+     * @brief API to get the path of the given watch descriptor.
+     *
+     *        - The path is rebuilt from the basenames of the watch and its
+     *          parent watches.
+     *        - A directory path has the trailing slash so that rsync syncs
+     *          the directory contents rather than the directory itself.
+     *
+     * @param[in] wd - Watch descriptor corresponding to the path
+     *
+     * @return The absolute path used to add the watch
+     *
+     * @note Throws std::out_of_range if the watch descriptor is not watched.
+     */
+    fs::path getPath(WD wd) const;
+
+    /**
+     * @brief API to find the watch of the given path using its inode.
+     *
+     * @param[in] path - The path of an existing file/directory
+     *
+     * @return The watch descriptor if the path is watched; otherwise
+     *         std::nullopt.
+     */
+    std::optional<WD> findWatch(const fs::path& path) const;
+
+    /**
+     * @brief API to wait for the inotify events and to dispatch them to the
+     *        subscribers of the respective watches.
+     *
+     *        - The pending watches are added first, and the events of the
+     *          already watched paths are dispatched in between the slices if
+     *          the inotify instance is non-blocking.
+     */
+    sdbusplus::async::task<> onEvents();
+
+    /**
+     * @brief API to schedule the pending watches of the given subscriber to
+     *        be added in slices while waiting for the events.
+     *
+     * @param[in] subscriber - The DataWatcher which has the pending watches
+     */
+    void schedulePendingWatches(DataWatcher* subscriber);
+
+    /**
+     * @brief API to cancel the pending watches of the given subscriber.
+     *
+     * @param[in] subscriber - The DataWatcher which is being destroyed
+     */
+    void cancelPendingWatches(DataWatcher* subscriber);
+
+    /**
+     * @brief API to check whether any subscriber has pending watches.
+     */
+    bool hasPendingWatches() const
+    {
+        return !_pendingSubscribers.empty();
+    }
+
+    /**
+     * @brief Get the number of watches placed in the kernel
+     */
+    size_t watchCount() const
+    {
+        return _watches.size() - _freeSlots.size();
+    }
+
+  private:
+    /**
+     * @brief The device and inode numbers which identify a watched path
+     */
+    using InodeKey = std::pair<dev_t, ino_t>;
+
+    /**
+     * @brief The hash of InodeKey
+     */
+    struct InodeKeyHash
+    {
+        size_t operator()(const InodeKey& key) const
+        {
+            return std::hash<ino_t>{}(key.second) ^
+                   (std::hash<dev_t>{}(key.first) << 1);
+        }
+    };
+
+    /**
+     * @brief The details of a watch
+     */
+    struct Watch
+    {
+        /**
+         * @brief The watch descriptor, -1 if the slot is free
+         */
+        WD _wd{-1};
+
+        /**
+         * @brief The watch descriptor of the parent directory, -1 if the
+         *        parent directory is not watched.
+         */
+        WD _parentWd{-1};
+
+        /**
+         * @brief The number of watches which refer this watch as parent
+         */
+        uint32_t _childCount{0};
+
+        /**
+         * @brief Indicates the watched path is a directory
+         */
+        bool _isDir{false};
+
+        /**
+         * @brief The inode of the watched path if known
+         */
+        std::optional<InodeKey> _inode;
+
+        /**
+         * @brief The basename of the path, or the absolute path if the parent
+         *        directory is not watched.
+         */
+        std::string _name;
+
+        /**
+         * @brief The DataWatcher instances which require the watch
+         */
+        std::vector<DataWatcher*> _subscribers;
+    };
+
+    /**
+     * @brief The size of the buffer used to read the inotify events.
+     *
+     * A single inotify event occupies at most
+     * sizeof(inotify_event) + NAME_MAX + 1 bytes, so the buffer can hold a
+     * burst of events per read() call.
+     */
+    static constexpr size_t eventBufferSize =
+        64 * (sizeof(struct inotify_event) + NAME_MAX + 1);
+
+    /**
+     * @brief The maximum number of directories visited to add the pending
+     *        watches before yielding back to the async context.
+     */
+    static constexpr size_t watchSetupSliceSize = 256;
+
+    /**
+     * @brief The sysctl file of the queued events limit of inotify instances
+     */
+    static constexpr auto queuedEventsLimitPath =
+        "/proc/sys/fs/inotify/max_queued_events";
+
+    /**
+     * @brief initialize an inotify instance and returns file descriptor
+     */
+    int inotifyInit() const;
+
+    /**
+     * @brief API to read the triggered events from inotify structure
+     *
+     * The API drains the whole inotify queue when the inotify instance is
+     * non-blocking, so that a burst of events is handled in a single wakeup.
+     *
+     * @param[out] receivedEvents - The events per subscriber
+     */
+    void readEvents(std::map<DataWatcher*, std::vector<EventInfo>>&
+                        receivedEvents);
+
+    /**
+     * @brief API to parse the inotify events from the given buffer and
+     *        append the events into the list of the interested subscribers.
+     *
+     * @param[in] buffer - The buffer which has the inotify events read from
+     *                     the inotify file descriptor.
+     * @param[out] receivedEvents - The events per subscriber
+     */
+    void parseEvents(std::span<const uint8_t> buffer,
+                     std::map<DataWatcher*, std::vector<EventInfo>>&
+                         receivedEvents);
+
+    /**
+     * @brief API to add the next slice of the pending watches of the
+     *        subscribers.
+     */
+    void addPendingWatches();
+
+    /**
+     * @brief API to dispatch the received events to the subscribers and to
+     *        release the watches removed by the kernel.
+     *
+     * @param[in] receivedEvents - The events per subscriber
+     */
+    void dispatchEvents(
+        std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents);
+
+    /**
+     * @brief API to handle the inotify queue overflow.
+     *
+     *        - Raises the queued events limit for the upcoming inotify
+     *          instances.
+     *        - Appends IN_Q_OVERFLOW into the events of all the subscribers.
+     *
+     * @param[out] receivedEvents - The events per subscriber
+     */
+    void handleQueueOverflow(
+        std::map<DataWatcher*, std::vector<EventInfo>>& receivedEvents);
+
+    /**
+     * @brief API to get the slot of the given watch descriptor in the table.
+     *
+     * @param[in] wd - Watch descriptor
+     *
+     * @return The index into the table if watched; otherwise std::nullopt.
+     */
+    std::optional<size_t> getSlot(WD wd) const;
+
+    /**
+     * @brief API to rebuild the path of the watch in the given slot into the
+     *        reusable path buffer, without the trailing slash.
+     *
+     * @param[in] slot - The index of the watch in the table
+     *
+     * @return The rebuilt path
+     */
+    const std::string& buildPath(size_t slot) const;
+
+    /**
+     * @brief API to link the given watch to the watch of its parent
+     *        directory if watched, otherwise to keep its absolute path.
+     *
+     * @param[in,out] watch - The watch to link
+     * @param[in] pathToWatch - The path of the watch
+     */
+    void linkToParent(Watch& watch, const fs::path& pathToWatch);
+
+    /**
+     * @brief API to release the slot of the given watch descriptor.
+     *
+     *        - The child watches are re-rooted with their absolute paths
+     *          since the parent basename is no longer available.
+     *
+     * @param[in] wd - Watch descriptor which is no longer watched
+     */
+    void releaseWatch(WD wd);
+
+    /**
+     * @brief The async context object
+     */
+    sdbusplus::async::context& _ctx;
+
+    /**
+     * @brief inotify flags
+     */
+    int _inotifyFlags;
+
+    /**
+     * @brief file descriptor referring to the inotify instance
+     */
+    utility::FD _inotifyFileDescriptor;
+
+    /**
+     * @brief fdio instance
+     */
+    std::unique_ptr<sdbusplus::async::fdio> _fdioInstance;
+
+    /**
+     * @brief Reusable buffer to read the inotify events from the inotify
+     *        file descriptor.
+     */
+    std::vector<uint8_t> _eventBuffer;
+
+    /**
+     * @brief The table of the watches.
+     *
+     * The slots of the removed watches are reused through _freeSlots.
+     */
+    std::vector<Watch> _watches;
+
+    /**
+     * @brief The slots in the table which are free to reuse
+     */
+    std::vector<size_t> _freeSlots;
+
+    /**
+     * @brief The index of the watch in the table plus one, indexed by the
+     *        watch descriptor, zero if not watched.
+     *
+     * @note The kernel allocates the watch descriptors sequentially per
+     *       inotify instance, hence this is small and dense.
+     */
+    std::vector<uint32_t> _slotIndex;
+
+    /**
+     * @brief The map of inode and the watch descriptor of the watched path
+     */
+    std::unordered_map<InodeKey, WD, InodeKeyHash> _inodeIndex;
+
+    /**
+     * @brief The watch descriptors removed by the kernel (IN_IGNORED) which
+     *        are released once the events are processed by the subscribers.
+     */
+    std::vector<WD> _ignoredWatches;
+
+    /**
+     * @brief The subscribers which have the pending watches, in the order
+     *        of scheduling.
+     */
+    std::deque<DataWatcher*> _pendingSubscribers;
+
+    /**
+     * @brief Reusable buffer to rebuild the paths of the watches
+     */
+    mutable std::string _pathBuffer;
+
+    /**
+     * @brief Reusable list of the path components while rebuilding a path
+     */
+    mutable std::vector<const std::string*> _pathComponents;
+};
+
+} // namespace data_sync::watch::inotify
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "path_matcher.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace data_sync::watch
+{
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief enum which indicates the type of operations that can take against an
+ * intersted inotify event on a configured data path
+ *
+ * MOVE indicates the path is renamed or moved from another path of the
+ * configured path, hence the sibling can reuse the data of the old path.
+ *
+ * RESYNC indicates the kernel event queue overflowed and the events of the
+ * configured path are lost, hence the whole path needs to be synced.
+ */
+enum class DataOps
+{
+    COPY,
+    DELETE,
+    MOVE,
+    RESYNC
+};
+
+/**
+ * @brief The data path and the type of operation, that needs to be performed
+ *        on the path.
+ */
+struct DataOperation
+{
+    /**
+     * @brief Absolute path of the file or directory, the new path in case
+     *        of MOVE.
+     */
+    fs::path _path;
+
+    /**
+     * @brief Operation to perform on the given path
+     */
+    DataOps _dataOp;
+
+    /**
+     * @brief The old path of the file or directory in case of MOVE.
+     */
+    fs::path _movedFromPath{};
+};
+
+/**
+ * @brief Container holding data paths and their corresponding operations.
+ */
+using DataOperations = std::vector<DataOperation>;
+
+/**
+ * @brief API to check whether the events are lost for the given data
+ *        operations.
+ *
+ * @param[in] dataOperations - The data operations of a configured path
+ *
+ * @return True if a resync is required; otherwise False.
+ */
+inline bool isResyncRequired(const DataOperations& dataOperations)
+{
+    return std::ranges::any_of(dataOperations, [](const auto& dataOperation) {
+        return dataOperation._dataOp == DataOps::RESYNC;
+    });
+}
+
+/**
+ * @brief The unique id of a subscriber of the watcher backend
+ */
+using SubscriberId = size_t;
+
+/**
+ * @brief The list of data operations received for each subscriber upon a
+ *        data change.
+ */
+using DataChanges = std::vector<std::pair<SubscriberId, DataOperations>>;
+
+/**
+ * @class WatcherBackend
+ *
+ * @brief This abstract class defines the interfaces of a backend which
+ *        monitors the configured paths of all its subscribers using a single
+ *        kernel notification instance and dispatches the data changes to
+ *        the respective subscribers.
+ */
+class WatcherBackend
+{
+  public:
+    WatcherBackend() = default;
+    WatcherBackend(const WatcherBackend&) = delete;
+    WatcherBackend& operator=(const WatcherBackend&) = delete;
+    WatcherBackend(WatcherBackend&&) = delete;
+    WatcherBackend& operator=(WatcherBackend&&) = delete;
+    virtual ~WatcherBackend() = default;
+
+    /**
+     * @brief API to subscribe for the data changes of the given path.
+     *
+     * @param[in] eventMasksToWatch - mask of interested inotify events to
+     *                                watch
+     * @param[in] dataPathToWatch - The absolute path to be monitored
+     * @param[in] excludeMatcher - The compiled list of paths to be excluded
+     *                             from monitoring
+     * @param[in] includeMatcher - The compiled list of paths should be
+     *                             included while monitoring
+     *
+     * @return The subscriber id to identify the data changes of the given
+     *         path.
+     *
+     * @note Throws std::runtime_error if the path can't be monitored.
+     */
+    virtual SubscriberId subscribe(
+        uint32_t eventMasksToWatch, const fs::path& dataPathToWatch,
+        const std::optional<config::PathMatcher>& excludeMatcher,
+        const std::optional<config::PathMatcher>& includeMatcher) = 0;
+
+    /**
+     * @brief API to stop monitoring the data changes for the given subscriber.
+     *
+     * @param[in] subscriberId - The id of the subscriber
+     */
+    virtual void unsubscribe(SubscriberId subscriberId) = 0;
+
+    /**
+     * @brief API to wait for the data changes of all the subscribers.
+     *
+     * @return The list of data operations per subscriber
+     */
+    virtual sdbusplus::async::task<DataChanges> onDataChange() = 0;
+
+    /**
+     * @brief API to get the paths being monitored for the given subscriber.
+     *
+     * @param[in] subscriberId - The id of the subscriber
+     *
+     * @return The list of monitoring paths
+     */
+    virtual std::vector<fs::path>
+        getWatchingPaths(SubscriberId subscriberId) const = 0;
+};
+
+} // namespace data_sync::watch
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "completion_latch.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::async::CompletionLatch;
+
+TEST(CompletionLatchTest, TestWaitForAllTasks)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    CompletionLatch latch(ctx);
+    std::vector<int> completedTasks;
+
+    // NOLINTNEXTLINE
+    auto task = [&](int id, std::chrono::milliseconds delay)
+        -> sdbusplus::async::task<> {
+        co_await sdbusplus::async::sleep_for(ctx, delay);
+        completedTasks.emplace_back(id);
+        latch.done();
+    };
+
+    // NOLINTNEXTLINE
+    auto join = [&]() -> sdbusplus::async::task<> {
+        for (int id = 0; id < 3; ++id)
+        {
+            latch.add();
+            ctx.spawn(task(id, std::chrono::milliseconds(30 - (id * 10))));
+        }
+        EXPECT_EQ(latch.getCount(), 3);
+
+        co_await latch.wait();
+        EXPECT_EQ(completedTasks, (std::vector<int>{2, 1, 0}));
+
+        // The latch is reusable and doesn't wait without any task.
+        co_await latch.wait();
+        latch.add();
+        ctx.spawn(task(3, 10ms));
+        co_await latch.wait();
+        EXPECT_EQ(completedTasks.size(), 4);
+
+        ctx.request_stop();
+    };
+
+    ctx.spawn(join());
+    ctx.run();
+
+    EXPECT_EQ(latch.getCount(), 0);
+}
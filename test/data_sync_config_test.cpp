@@ -135,7 +135,8 @@ TEST(DataSyncConfigParserTest, TestImmediateDirectorySyncWithNoRetry)
     EXPECT_EQ(dataSyncConfig._excludeList->first,
               configJSON["ExcludeList"].get<std::unordered_set<fs::path>>());
     EXPECT_EQ(dataSyncConfig._excludeList->second,
-              " --filter='-/ /Path/of/files/must/be/ignored/for/sync'");
+              std::vector<std::string>{
+                  "--filter=-/ /Path/of/files/must/be/ignored/for/sync"});
     EXPECT_EQ(dataSyncConfig._includeList.value(),
               configJSON["IncludeList"].get<std::unordered_set<fs::path>>());
 }
@@ -488,3 +489,157 @@ TEST(DataSyncConfigParserTest, TestSyncConfigWithSelectivePathSiblingNotify)
     EXPECT_EQ(dataSyncConfig._excludeList, std::nullopt);
     EXPECT_EQ(dataSyncConfig._includeList, std::nullopt);
 }
+
+/*
+ * Test when the input JSON contains the debounce details with fractional
+ * seconds and with the default max latency.
+ */
+TEST(DataSyncConfigParserTest, TestFileSyncWithDebounce)
+{
+    const auto configJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate",
+            "Debounce": "PT0.5S"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig dataSyncConfig(configJSON, false);
+
+    if (!dataSyncConfig._debounce.has_value())
+    {
+        FAIL() << "Missing debounce configuration.";
+    }
+    EXPECT_EQ(dataSyncConfig._debounce.value()._settleWindow,
+              std::chrono::milliseconds(500));
+    EXPECT_EQ(dataSyncConfig._debounce.value()._maxLatency,
+              std::chrono::milliseconds(5000));
+
+    const auto configWithMaxLatencyJSON = R"(
+        {
+            "Path": "/directory/path/to/sync/",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate",
+            "Debounce": "PT1.25S",
+            "DebounceMaxLatency": "PT1M2S"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig dataSyncDirConfig(
+        configWithMaxLatencyJSON, true);
+
+    if (!dataSyncDirConfig._debounce.has_value())
+    {
+        FAIL() << "Missing debounce configuration.";
+    }
+    EXPECT_EQ(dataSyncDirConfig._debounce.value()._settleWindow,
+              std::chrono::milliseconds(1250));
+    EXPECT_EQ(dataSyncDirConfig._debounce.value()._maxLatency,
+              std::chrono::seconds(62));
+}
+
+/*
+ * Test when the input JSON contains the criticality and when it defaults.
+ */
+TEST(DataSyncConfigParserTest, TestFileSyncWithCriticality)
+{
+    const auto configJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate",
+            "Criticality": "High"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig dataSyncConfig(configJSON, false);
+    EXPECT_EQ(dataSyncConfig._criticality,
+              data_sync::config::Criticality::High);
+    EXPECT_EQ(dataSyncConfig.getCriticalityInStr(), "High");
+
+    const auto configWithoutCriticalityJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig defaultConfig(
+        configWithoutCriticalityJSON, false);
+    EXPECT_EQ(defaultConfig._criticality,
+              data_sync::config::Criticality::Medium);
+}
+
+/*
+ * Test when the input JSON contains the max periodicity to back off the
+ * periodic sync and when it is not greater than the periodicity.
+ */
+TEST(DataSyncConfigParserTest, TestPeriodicFileSyncWithMaxPeriodicity)
+{
+    const auto configJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Periodic",
+            "Periodicity": "PT1M",
+            "MaxPeriodicity": "PT10M"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig dataSyncConfig(configJSON, false);
+    EXPECT_EQ(dataSyncConfig._periodicityInSec, std::chrono::seconds(60));
+    EXPECT_EQ(dataSyncConfig._maxPeriodicityInSec, std::chrono::seconds(600));
+
+    const auto configWithLowerMaxJSON = R"(
+        {
+            "Path": "/file/path/to/sync",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Periodic",
+            "Periodicity": "PT1M",
+            "MaxPeriodicity": "PT30S"
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig lowerMaxConfig(configWithLowerMaxJSON,
+                                                     false);
+    EXPECT_EQ(lowerMaxConfig._maxPeriodicityInSec, std::nullopt);
+}
+
+/*
+ * Test when the input JSON contains the glob patterns in the exclude list.
+ */
+TEST(DataSyncConfigParserTest, TestDirectorySyncWithExcludeGlob)
+{
+    const auto configJSON = R"(
+        {
+            "Path": "/directory/path/to/sync/",
+            "Description": "Add details about the data and purpose of the synchronization",
+            "SyncDirection": "Active2Passive",
+            "SyncType": "Immediate",
+            "ExcludeList": ["*.tmp"]
+        }
+    )"_json;
+
+    data_sync::config::DataSyncConfig dataSyncConfig(configJSON, true);
+
+    if (!dataSyncConfig._excludeList.has_value() ||
+        !dataSyncConfig._excludeMatcher.has_value())
+    {
+        FAIL() << "Expected excludeList to have configurations, but missing.";
+    }
+    EXPECT_EQ(dataSyncConfig._excludeList->second,
+              std::vector<std::string>{"--filter=- *.tmp"});
+    EXPECT_TRUE(dataSyncConfig._excludeMatcher->matches(
+        "/directory/path/to/sync/dir/file.tmp", false));
+    EXPECT_FALSE(dataSyncConfig._excludeMatcher->matches(
+        "/directory/path/to/sync/dir/file", false));
+    EXPECT_EQ(dataSyncConfig._includeMatcher, std::nullopt);
+}
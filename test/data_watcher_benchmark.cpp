@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * A micro benchmark to measure how fast the inotify events are consumed
+ * under a synthetic burst of file writes.
+ *
+ * - "single read per wakeup" reads one sizeof(inotify_event) + NAME_MAX + 1
+ *   sized buffer per fdio wakeup, that is how DataWatcher::readEvents() used
+ *   to read the events.
+ * - "DataWatcher" uses DataWatcher::onDataChange() which drains the whole
+ *   inotify queue per wakeup.
+ *
+ * The burst is written before the consumer starts, so only the event
+ * consumption is measured.
+ */
+
+#include "data_watcher.hpp"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <string>
+
+namespace fs = std::filesystem;
+namespace watch = data_sync::watch::inotify;
+
+namespace
+{
+
+constexpr size_t burstSize = 10000;
+
+struct BenchResult
+{
+    size_t events{0};
+    size_t wakeups{0};
+    std::chrono::duration<double> elapsed{};
+};
+
+void writeBurst(const fs::path& dir, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::ofstream file(dir / ("file_" + std::to_string(i)));
+        file << i;
+    }
+}
+
+sdbusplus::async::task<> consumeWithSingleRead(sdbusplus::async::context& ctx,
+                                               int fd, BenchResult& result)
+{
+    sdbusplus::async::fdio fdioInstance(ctx, fd);
+    constexpr auto maxBytes = sizeof(struct inotify_event) + NAME_MAX + 1;
+    alignas(inotify_event) uint8_t buffer[maxBytes];
+
+    auto start = std::chrono::steady_clock::now();
+    while (result.events < burstSize)
+    {
+        co_await fdioInstance.next();
+        ++result.wakeups;
+
+        auto bytes = read(fd, buffer, maxBytes);
+        size_t offset = 0;
+        while (bytes > 0 && offset < static_cast<size_t>(bytes))
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto* event = reinterpret_cast<inotify_event*>(&buffer[offset]);
+            ++result.events;
+            offset += offsetof(inotify_event, name) + event->len;
+        }
+    }
+    result.elapsed = std::chrono::steady_clock::now() - start;
+    ctx.request_stop();
+    co_return;
+}
+
+sdbusplus::async::task<> consumeWithDataWatcher(
+    sdbusplus::async::context& ctx, watch::DataWatcher& watcher,
+    BenchResult& result)
+{
+    auto start = std::chrono::steady_clock::now();
+    while (result.events < burstSize)
+    {
+        auto dataOps = co_await watcher.onDataChange();
+        ++result.wakeups;
+        result.events += dataOps.size();
+    }
+    result.elapsed = std::chrono::steady_clock::now() - start;
+    ctx.request_stop();
+    co_return;
+}
+
+BenchResult runSingleRead(const fs::path& dir)
+{
+    BenchResult result;
+    sdbusplus::async::context ctx;
+
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0 || inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE) < 0)
+    {
+        std::println(stderr, "Failed to setup inotify on {}", dir.string());
+        std::exit(EXIT_FAILURE);
+    }
+
+    writeBurst(dir, burstSize);
+    ctx.spawn(consumeWithSingleRead(ctx, fd, result));
+    ctx.run();
+
+    close(fd);
+    return result;
+}
+
+BenchResult runDataWatcher(const fs::path& dir)
+{
+    BenchResult result;
+    sdbusplus::async::context ctx;
+
+    watch::DataWatcher watcher(ctx, IN_NONBLOCK, IN_CLOSE_WRITE, dir);
+
+    writeBurst(dir, burstSize);
+    ctx.spawn(consumeWithDataWatcher(ctx, watcher, result));
+    ctx.run();
+
+    return result;
+}
+
+void report(std::string_view name, const BenchResult& result)
+{
+    std::println("{:<24} events: {:>6} wakeups: {:>6} time: {:>8.3f} ms "
+                 "rate: {:>12.0f} events/sec",
+                 name, result.events, result.wakeups,
+                 result.elapsed.count() * 1000,
+                 static_cast<double>(result.events) / result.elapsed.count());
+}
+
+} // namespace
+
+int main()
+{
+    char tmpl[] = "/tmp/data_watcher_bench_XXXXXX";
+    if (mkdtemp(tmpl) == nullptr)
+    {
+        std::println(stderr, "Failed to create the temporary directory");
+        return EXIT_FAILURE;
+    }
+    fs::path benchDir{tmpl};
+
+    fs::create_directory(benchDir / "singleRead");
+    fs::create_directory(benchDir / "dataWatcher");
+
+    report("single read per wakeup", runSingleRead(benchDir / "singleRead"));
+    report("DataWatcher", runDataWatcher(benchDir / "dataWatcher"));
+
+    fs::remove_all(benchDir);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fanotify_watcher.hpp"
+#include "inotify_watcher.hpp"
+
+#include <linux/capability.h>
+#include <sys/inotify.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+namespace fanotify = data_sync::watch::fanotify;
+namespace inotify = data_sync::watch::inotify;
+using data_sync::watch::DataOperation;
+using data_sync::watch::DataOperations;
+using data_sync::watch::DataOps;
+
+class FanotifyWatcherTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!hasCapSysAdmin())
+        {
+            GTEST_SKIP() << "fanotify requires CAP_SYS_ADMIN";
+        }
+
+        char tmpdir[] = "/tmp/fanotifyWatcherTestXXXXXX";
+        testDir = mkdtemp(tmpdir);
+        fs::create_directories(testDir / "dir1");
+        fs::create_directories(testDir / "dir2");
+        std::ofstream(testDir / "dir1" / "modified") << "Data";
+        std::ofstream(testDir / "dir1" / "deleted") << "Data";
+        std::ofstream(testDir / "dir1" / "renamed") << "Data";
+    }
+
+    void TearDown() override
+    {
+        if (!testDir.empty())
+        {
+            fs::remove_all(testDir);
+        }
+    }
+
+    /**
+     * @brief Check the effective capabilities of the test process since
+     *        fanotify_init() fails with EPERM without CAP_SYS_ADMIN.
+     */
+    static bool hasCapSysAdmin()
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("CapEff:"))
+            {
+                auto capEff = std::stoull(line.substr(7), nullptr, 16);
+                return (capEff & (1ULL << CAP_SYS_ADMIN)) != 0;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Subscribe the fanotify watcher, returns nullopt if the
+     *        filesystem of the test directory doesn't support file handles.
+     */
+    static std::optional<data_sync::watch::SubscriberId>
+        subscribe(fanotify::FanotifyWatcher& fanotifyWatcher,
+                  const fs::path& dataPath)
+    {
+        try
+        {
+            return fanotifyWatcher.subscribe(eventMasksToWatch, dataPath,
+                                             std::nullopt, std::nullopt);
+        }
+        catch (const std::runtime_error&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    static void sortByPath(DataOperations& dataOperations)
+    {
+        std::ranges::sort(dataOperations, {},
+                          [](const auto& dataOperation) {
+                              return dataOperation._path;
+                          });
+    }
+
+    static constexpr uint32_t eventMasksToWatch =
+        IN_CLOSE_WRITE | IN_MOVE | IN_DELETE_SELF | IN_CREATE | IN_DELETE;
+
+    fs::path testDir;
+};
+
+TEST_F(FanotifyWatcherTest, TestDataOperationsSameAsInotify)
+{
+    sdbusplus::async::context ctx;
+    inotify::InotifyWatcher inotifyWatcher(ctx);
+    fanotify::FanotifyWatcher fanotifyWatcher(ctx);
+
+    if (!subscribe(fanotifyWatcher, testDir / "dir1" / "").has_value())
+    {
+        GTEST_SKIP() << "The filesystem of " << testDir
+                     << " doesn't support fanotify filesystem marks";
+    }
+    inotifyWatcher.subscribe(eventMasksToWatch, testDir / "dir1" / "",
+                             std::nullopt, std::nullopt);
+
+    // Create, modify, delete and rename inside the configured path
+    std::ofstream(testDir / "dir1" / "created") << "Data";
+    std::ofstream(testDir / "dir1" / "modified") << "Modified data";
+    fs::remove(testDir / "dir1" / "deleted");
+    fs::rename(testDir / "dir1" / "renamed", testDir / "dir1" / "renamed.1");
+
+    // NOLINTNEXTLINE
+    auto waitForDataChange = [&]() -> sdbusplus::async::task<void> {
+        // NOLINTNEXTLINE
+        auto inotifyChanges = co_await inotifyWatcher.onDataChange();
+        // NOLINTNEXTLINE
+        auto fanotifyChanges = co_await fanotifyWatcher.onDataChange();
+
+        EXPECT_EQ(inotifyChanges.size(), 1);
+        EXPECT_EQ(fanotifyChanges.size(), 1);
+        if (inotifyChanges.size() == 1 && fanotifyChanges.size() == 1)
+        {
+            auto& inotifyOperations = inotifyChanges[0].second;
+            auto& fanotifyOperations = fanotifyChanges[0].second;
+            sortByPath(inotifyOperations);
+            sortByPath(fanotifyOperations);
+
+            EXPECT_EQ(fanotifyOperations.size(), 4);
+            EXPECT_EQ(fanotifyOperations.size(), inotifyOperations.size());
+            for (size_t i = 0; i < std::min(fanotifyOperations.size(),
+                                            inotifyOperations.size());
+                 ++i)
+            {
+                EXPECT_EQ(fanotifyOperations[i]._path,
+                          inotifyOperations[i]._path);
+                EXPECT_EQ(fanotifyOperations[i]._dataOp,
+                          inotifyOperations[i]._dataOp);
+                EXPECT_EQ(fanotifyOperations[i]._movedFromPath,
+                          inotifyOperations[i]._movedFromPath);
+            }
+
+            auto renamed = std::ranges::find(fanotifyOperations,
+                                             testDir / "dir1" / "renamed.1",
+                                             &DataOperation::_path);
+            EXPECT_NE(renamed, fanotifyOperations.end());
+            if (renamed != fanotifyOperations.end())
+            {
+                EXPECT_EQ(renamed->_dataOp, DataOps::MOVE);
+                EXPECT_EQ(renamed->_movedFromPath,
+                          testDir / "dir1" / "renamed");
+            }
+        }
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(waitForDataChange());
+    ctx.run();
+}
+
+TEST_F(FanotifyWatcherTest, TestEventsOutsideConfiguredPathDropped)
+{
+    sdbusplus::async::context ctx;
+    fanotify::FanotifyWatcher fanotifyWatcher(ctx);
+
+    auto subscriber = subscribe(fanotifyWatcher, testDir / "dir1" / "");
+    if (!subscriber.has_value())
+    {
+        GTEST_SKIP() << "The filesystem of " << testDir
+                     << " doesn't support fanotify filesystem marks";
+    }
+
+    // The filesystem mark reports these, but they aren't under dir1
+    std::ofstream(testDir / "dir2" / "file") << "Data";
+    std::ofstream(testDir / "file") << "Data";
+    fs::rename(testDir / "dir2" / "file", testDir / "dir2" / "file.1");
+
+    // Moved into and out of the configured path
+    fs::rename(testDir / "file", testDir / "dir1" / "movedIn");
+    fs::rename(testDir / "dir1" / "modified", testDir / "dir2" / "movedOut");
+
+    std::ofstream(testDir / "dir1" / "file") << "Data";
+
+    // NOLINTNEXTLINE
+    auto waitForDataChange = [&]() -> sdbusplus::async::task<void> {
+        // NOLINTNEXTLINE
+        auto dataChanges = co_await fanotifyWatcher.onDataChange();
+
+        EXPECT_EQ(dataChanges.size(), 1);
+        for (auto& [subscriberId, dataOperations] : dataChanges)
+        {
+            EXPECT_EQ(subscriberId, subscriber.value());
+            sortByPath(dataOperations);
+
+            EXPECT_EQ(dataOperations.size(), 3);
+            if (dataOperations.size() == 3)
+            {
+                EXPECT_EQ(dataOperations[0]._path, testDir / "dir1" / "file");
+                EXPECT_EQ(dataOperations[0]._dataOp, DataOps::COPY);
+
+                EXPECT_EQ(dataOperations[1]._path,
+                          testDir / "dir1" / "modified");
+                EXPECT_EQ(dataOperations[1]._dataOp, DataOps::DELETE);
+
+                EXPECT_EQ(dataOperations[2]._path,
+                          testDir / "dir1" / "movedIn");
+                EXPECT_EQ(dataOperations[2]._dataOp, DataOps::COPY);
+            }
+        }
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(waitForDataChange());
+    ctx.run();
+}
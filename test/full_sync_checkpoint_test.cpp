@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "full_sync_checkpoint.hpp"
+
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+using data_sync::persist::FullSyncCheckpoint;
+
+class FullSyncCheckpointTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/fullSyncCheckpointTestXXXXXX";
+        testDir = mkdtemp(tmpdir);
+        checkpointFile = testDir / "fullSyncCheckpoint.json";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    static constexpr uint64_t generation = 1234;
+
+    fs::path testDir;
+    fs::path checkpointFile;
+};
+
+TEST_F(FullSyncCheckpointTest, TestCompletedEntriesResumed)
+{
+    const auto shardKey = FullSyncCheckpoint::getShardKey("/dir/", 1, 4);
+    {
+        FullSyncCheckpoint checkpoint(checkpointFile);
+        EXPECT_EQ(checkpoint.load(generation), 0);
+
+        checkpoint.markCompleted("/file1");
+        checkpoint.markCompleted(shardKey);
+        EXPECT_TRUE(checkpoint.isCompleted("/file1"));
+    }
+
+    // The interrupted full sync is resumed by the next one.
+    FullSyncCheckpoint checkpoint(checkpointFile);
+    EXPECT_EQ(checkpoint.load(generation), 2);
+    EXPECT_TRUE(checkpoint.isCompleted("/file1"));
+    EXPECT_TRUE(checkpoint.isCompleted(shardKey));
+    EXPECT_FALSE(checkpoint.isCompleted("/file2"));
+    EXPECT_FALSE(
+        checkpoint.isCompleted(FullSyncCheckpoint::getShardKey("/dir/", 2, 4)));
+
+    // The completed full sync doesn't leave the checkpoint.
+    checkpoint.clear();
+    EXPECT_FALSE(fs::exists(checkpointFile));
+    EXPECT_EQ(checkpoint.load(generation), 0);
+}
+
+TEST_F(FullSyncCheckpointTest, TestDifferentGenerationDropped)
+{
+    {
+        FullSyncCheckpoint checkpoint(checkpointFile);
+        checkpoint.load(generation);
+        checkpoint.markCompleted("/file1");
+    }
+
+    FullSyncCheckpoint checkpoint(checkpointFile);
+    EXPECT_EQ(checkpoint.load(generation + 1), 0);
+    EXPECT_FALSE(checkpoint.isCompleted("/file1"));
+    EXPECT_FALSE(fs::exists(checkpointFile));
+}
@@ -147,6 +147,32 @@ TEST_F(ManagerTest, FullSyncA2PTest)
         EXPECT_EQ(status, FullSyncStatus::FullSyncCompleted)
             << "FullSync status is not Completed!";
 
+        // The results of all the configurations are joined.
+        const auto& fullSyncResults = manager.getFullSyncResults();
+        EXPECT_EQ(fullSyncResults.size(), 5);
+        for (const auto& cfgResult : fullSyncResults)
+        {
+            EXPECT_TRUE(cfgResult._success) << cfgResult._path;
+            EXPECT_EQ(cfgResult._exitCode, 0) << cfgResult._path;
+        }
+
+        // The sizes are kept to order the next full sync.
+        auto cfgSizes = data_sync::persist::read<std::map<std::string, size_t>>(
+            data_sync::persist::key::fullSyncSizes,
+            data_sync::persist::FullSyncStatsFile);
+        EXPECT_TRUE(cfgSizes.has_value());
+        EXPECT_EQ(cfgSizes.value_or(std::map<std::string, size_t>{}).size(),
+                  5);
+
+        const auto progress = manager.getFullSyncProgress();
+        EXPECT_EQ(progress._completedCfgs, 5);
+        EXPECT_EQ(progress._totalCfgs, 5);
+        EXPECT_EQ(progress._processedBytes, progress._estimatedBytes);
+        EXPECT_EQ(progress._remainingTime.count(), 0);
+
+        // The completed full sync doesn't leave the checkpoint to resume.
+        EXPECT_FALSE(fs::exists(data_sync::persist::FullSyncCheckpointFile));
+
         EXPECT_EQ(ManagerTest::readData(destDir1 / fs::relative(srcFile1, "/")),
                   data1);
         EXPECT_EQ(ManagerTest::readData(destDir2 / fs::relative(srcFile2, "/")),
@@ -643,6 +669,10 @@ TEST_F(ManagerTest, FullSyncFailed)
                   data3);
         EXPECT_FALSE(fs::exists(destDir4 / fs::relative(srcFile4, "/")));
 
+        // The synced configurations are checkpointed to resume only the
+        // failed one in the next full sync.
+        EXPECT_TRUE(fs::exists(data_sync::persist::FullSyncCheckpointFile));
+
         // Wait to ensure the immediate and periodic sync tasks configured
         // in the test setup are spawned. If the context is stopped while
         // spawning is still in progress, the spawn will fail.
@@ -1203,3 +1233,328 @@ TEST_F(ManagerTest, FullSyncWithRetryTest)
     EXPECT_EQ(manager.getSyncEventsHealth(), SyncEventsHealth::Ok)
         << "Health should be Ok after the retry";
 }
+
+/*
+ * Test the Full sync of a directory configured with the shards, ensuring that
+ * the subdirectories of all the shards and the top level files are synced,
+ * and the subdirectory removed from the source is deleted in the destination.
+ */
+
+TEST_F(ManagerTest, FullSyncShardedDirTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcDir/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Sharded FullSync from Active to Passive bmc"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"FullSyncShards", 2}}}}};
+
+    fs::path srcDir = jsonData["Directories"][0]["Path"];
+    fs::path destDir = jsonData["Directories"][0]["DestinationPath"];
+
+    std::vector<fs::path> subDirFiles;
+    for (const auto& subDir : {"subDir1", "subDir2", "subDir3", "subDir4"})
+    {
+        fs::create_directories(srcDir / subDir);
+        subDirFiles.emplace_back(srcDir / subDir / "subDirFile");
+        ManagerTest::writeData(subDirFiles.back(), subDir);
+    }
+    fs::path dirFile = srcDir / "dirFile";
+    ManagerTest::writeData(dirFile, "Data in directory file");
+
+    // The subdirectory which is removed from the source.
+    fs::path staleSubDir = destDir / fs::relative(srcDir, "/") / "staleDir";
+    fs::create_directories(staleSubDir);
+    ManagerTest::writeData(staleSubDir / "staleFile", "Stale data");
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir};
+
+    auto waitingForFullSyncToFinish =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        auto status = manager.getFullSyncStatus();
+
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            co_await sdbusplus::async::sleep_for(ctx,
+                                                 std::chrono::milliseconds(50));
+            status = manager.getFullSyncStatus();
+        }
+
+        EXPECT_EQ(status, FullSyncStatus::FullSyncCompleted)
+            << "FullSync status is not Completed!";
+
+        for (const auto& subDirFile : subDirFiles)
+        {
+            EXPECT_EQ(
+                ManagerTest::readData(destDir / fs::relative(subDirFile, "/")),
+                subDirFile.parent_path().filename().string());
+        }
+        EXPECT_EQ(ManagerTest::readData(destDir / fs::relative(dirFile, "/")),
+                  "Data in directory file");
+        EXPECT_FALSE(fs::exists(staleSubDir));
+
+        // The results of the shards are merged into the configuration result.
+        const auto& fullSyncResults = manager.getFullSyncResults();
+        EXPECT_EQ(fullSyncResults.size(), 1);
+        EXPECT_TRUE(std::ranges::all_of(fullSyncResults, [](const auto& r) {
+            return r._success && r._exitCode == 0;
+        }));
+
+        co_await sdbusplus::async::sleep_for(ctx,
+                                             std::chrono::milliseconds(50));
+        ctx.request_stop();
+
+        // Forcing to trigger inotify events so that all running immediate
+        // sync tasks will resume and stop since the context is requested to
+        // stop in the above.
+        ManagerTest::writeData(dirFile, "Data in directory file");
+
+        co_return;
+    };
+
+    ctx.spawn(waitingForFullSyncToFinish(ctx));
+    ctx.run();
+}
+
+/*
+ * Test the full sync estimate reports the files and the bytes which would
+ * transfer by the dry-run, without syncing them.
+ */
+TEST_F(ManagerTest, FullSyncEstimateTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // Periodic so that the modified file is not synced until the estimate.
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcDir/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "FullSync estimate from Active to Passive bmc"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1H"}}}}};
+
+    fs::path srcDir = jsonData["Directories"][0]["Path"];
+    fs::path destDir = jsonData["Directories"][0]["DestinationPath"];
+
+    fs::create_directories(srcDir);
+    fs::path dirFile = srcDir / "dirFile";
+    ManagerTest::writeData(dirFile, "Data in directory file");
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir};
+
+    auto waitingForFullSyncToEstimate =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        auto status = manager.getFullSyncStatus();
+
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            co_await sdbusplus::async::sleep_for(ctx,
+                                                 std::chrono::milliseconds(50));
+            status = manager.getFullSyncStatus();
+        }
+
+        EXPECT_EQ(status, FullSyncStatus::FullSyncCompleted)
+            << "FullSync status is not Completed!";
+
+        // Nothing to transfer after the full sync.
+        auto estimates = co_await manager.estimateFullSync();
+        EXPECT_EQ(estimates.size(), 1);
+        for (const auto& estimate : estimates)
+        {
+            EXPECT_TRUE(estimate._success);
+            EXPECT_EQ(estimate._files, 0);
+            EXPECT_EQ(estimate._bytes, 0);
+        }
+
+        std::string newData{"Modified data in directory file"};
+        fs::path newFile = srcDir / "newFile";
+        ManagerTest::writeData(dirFile, newData);
+        ManagerTest::writeData(newFile, "New file");
+
+        estimates = co_await manager.estimateFullSync();
+        EXPECT_EQ(estimates.size(), 1);
+        for (const auto& estimate : estimates)
+        {
+            EXPECT_TRUE(estimate._success);
+            EXPECT_EQ(estimate._exitCode, 0);
+            EXPECT_EQ(estimate._files, 2);
+            EXPECT_EQ(estimate._bytes, newData.size() + "New file"s.size());
+        }
+
+        // The dry-run doesn't sync.
+        EXPECT_EQ(ManagerTest::readData(destDir / fs::relative(dirFile, "/")),
+                  "Data in directory file");
+        EXPECT_FALSE(fs::exists(destDir / fs::relative(newFile, "/")));
+
+        ctx.request_stop();
+
+        co_return;
+    };
+
+    ctx.spawn(waitingForFullSyncToEstimate(ctx));
+    ctx.run();
+}
+
+/*
+ * Test the full sync skips the subtrees which are not changed since the
+ * sibling received those by the previous full sync.
+ */
+TEST_F(ManagerTest, FullSyncSkipUnchangedSubtreesTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    // Periodic so that the modified file is synced only by the full sync.
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcDir/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "FullSync from Active to Passive bmc"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1H"}}}}};
+
+    fs::path srcDir = jsonData["Directories"][0]["Path"];
+    fs::path destDir = jsonData["Directories"][0]["DestinationPath"];
+
+    fs::path changedFile = srcDir / "changedDir" / "file";
+    fs::path unchangedFile = srcDir / "unchangedDir" / "file";
+    fs::create_directories(changedFile.parent_path());
+    fs::create_directories(unchangedFile.parent_path());
+    ManagerTest::writeData(changedFile, "Data in changed directory");
+    ManagerTest::writeData(unchangedFile, "Data in unchanged directory");
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir};
+
+    auto waitingForFullSyncToFinish =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        auto status = manager.getFullSyncStatus();
+
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            co_await sdbusplus::async::sleep_for(ctx,
+                                                 std::chrono::milliseconds(50));
+            status = manager.getFullSyncStatus();
+        }
+
+        EXPECT_EQ(status, FullSyncStatus::FullSyncCompleted)
+            << "FullSync status is not Completed!";
+
+        // The sibling keeps the digests of the received data.
+        EXPECT_TRUE(fs::exists(data_sync::persist::ReceivedDigestsFile));
+
+        // Tamper the unchanged subtree in the destination to verify that it
+        // is not synced again.
+        fs::path destUnchangedFile = destDir /
+                                     fs::relative(unchangedFile, "/");
+        ManagerTest::writeData(destUnchangedFile, "Tampered data");
+        ManagerTest::writeData(changedFile, "Modified data");
+
+        co_await manager.startFullSync();
+
+        EXPECT_EQ(manager.getFullSyncStatus(),
+                  FullSyncStatus::FullSyncCompleted);
+        EXPECT_EQ(
+            ManagerTest::readData(destDir / fs::relative(changedFile, "/")),
+            "Modified data");
+        EXPECT_EQ(ManagerTest::readData(destUnchangedFile), "Tampered data");
+
+        ctx.request_stop();
+
+        co_return;
+    };
+
+    ctx.spawn(waitingForFullSyncToFinish(ctx));
+    ctx.run();
+}
@@ -5,8 +5,13 @@
 
 #include <sdbusplus/async.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
 #include <string_view>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -914,3 +919,538 @@ TEST_F(ManagerTest, ImmediateSyncVanishedPathRetrySucceeds)
     ctx->spawn(triggerAndWatchSyncOp());
     ctx->run();
 }
+
+TEST_F(ManagerTest, testDataChangeParkedWhileSiblingIsDown)
+{
+    using namespace std::literals;
+    namespace extData = data_sync::ext_data;
+
+    auto extDataIface = std::make_unique<extData::MockExternalDataIFaces>();
+    extData::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<extData::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(extData::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "File to test the sync parked while sibling down"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    fs::path srcPath{jsonData["Files"][0]["Path"]};
+    fs::path destDir{jsonData["Files"][0]["DestinationPath"]};
+    fs::path destPath = destDir / fs::relative(srcPath, "/");
+
+    writeConfig(jsonData);
+    auto ctx = std::make_shared<sdbusplus::async::context>();
+
+    std::string data{"Src: Initial Data\n"};
+    ManagerTest::writeData(srcPath, data);
+    ASSERT_EQ(ManagerTest::readData(srcPath), data);
+
+    auto manager = std::make_shared<data_sync::Manager>(
+        *ctx, std::move(extDataIface), ManagerTest::dataSyncCfgDir);
+
+    // NOLINTNEXTLINE
+    auto triggerAndWatchSyncOp = [manager, srcPath, destPath,
+                                  ctx]() -> sdbusplus::async::task<void> {
+        // Wait for full sync to complete
+        auto status = manager->getFullSyncStatus();
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            status = manager->getFullSyncStatus();
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        EXPECT_EQ(ManagerTest::readData(destPath), "Src: Initial Data\n");
+
+        // The change is parked rather than synced while the sibling is down.
+        manager->siblingReachabilityChanged(false);
+        std::string dataToWrite{"Data is modified"};
+        ManagerTest::writeData(srcPath, dataToWrite);
+        co_await sdbusplus::async::sleep_for(*ctx, 1s);
+        EXPECT_NE(ManagerTest::readData(destPath), dataToWrite);
+        EXPECT_EQ(manager->getParkedSyncsCount(), 1);
+
+        // The parked change is synced once the sibling is back.
+        manager->siblingReachabilityChanged(true);
+        EXPECT_EQ(manager->getParkedSyncsCount(), 0);
+        for (size_t count = 0;
+             count < 40 && ManagerTest::readData(destPath) != dataToWrite;
+             ++count)
+        {
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        EXPECT_EQ(ManagerTest::readData(destPath), dataToWrite);
+
+        // Force an inotify event so running immediate sync tasks wake up
+        // handle the last write, and exit once the context stop is
+        // requested
+        ManagerTest::writeData(srcPath, "Dummy data to stop ctx");
+        ctx->request_stop();
+    };
+
+    ctx->spawn(triggerAndWatchSyncOp());
+    ctx->run();
+}
+
+TEST_F(ManagerTest, testDebounceCoalescesWritesIntoOneSync)
+{
+    using namespace std::literals;
+    namespace extData = data_sync::ext_data;
+
+    auto extDataIface = std::make_unique<extData::MockExternalDataIFaces>();
+    extData::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<extData::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(extData::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "File to test the debounced writes"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"Debounce", "PT0.5S"},
+           {"DebounceMaxLatency", "PT10S"}}}}};
+
+    fs::path srcPath{jsonData["Files"][0]["Path"]};
+    fs::path destDir{jsonData["Files"][0]["DestinationPath"]};
+    fs::path destPath = destDir / fs::relative(srcPath, "/");
+
+    writeConfig(jsonData);
+    auto ctx = std::make_shared<sdbusplus::async::context>();
+
+    ManagerTest::writeData(srcPath, "Src: Initial Data\n");
+
+    auto manager = std::make_shared<data_sync::Manager>(
+        *ctx, std::move(extDataIface), ManagerTest::dataSyncCfgDir);
+
+    // NOLINTNEXTLINE
+    auto triggerAndWatchSyncOp = [manager, srcPath, destPath,
+                                  ctx]() -> sdbusplus::async::task<void> {
+        // Wait for full sync to complete
+        auto status = manager->getFullSyncStatus();
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            status = manager->getFullSyncStatus();
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        const auto initialSyncs =
+            manager->getSyncStats(data_sync::async::SyncPriority::Immediate)
+                ._granted;
+
+        // The writes within the settle window of each other are coalesced.
+        std::string dataToWrite;
+        for (size_t count = 0; count < 5; ++count)
+        {
+            dataToWrite = "Data is modified " + std::to_string(count);
+            ManagerTest::writeData(srcPath, dataToWrite);
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        EXPECT_NE(ManagerTest::readData(destPath), dataToWrite);
+
+        co_await sdbusplus::async::sleep_for(*ctx, 1500ms);
+        EXPECT_EQ(ManagerTest::readData(destPath), dataToWrite);
+        EXPECT_EQ(
+            manager->getSyncStats(data_sync::async::SyncPriority::Immediate)
+                    ._granted -
+                initialSyncs,
+            1);
+
+        // Force an inotify event so running immediate sync tasks wake up
+        // handle the last write, and exit once the context stop is
+        // requested
+        ManagerTest::writeData(srcPath, "Dummy data to stop ctx");
+        ctx->request_stop();
+    };
+
+    ctx->spawn(triggerAndWatchSyncOp());
+    ctx->run();
+}
+
+TEST_F(ManagerTest, testDebounceFlushesTrickleAtMaxLatency)
+{
+    using namespace std::literals;
+    namespace extData = data_sync::ext_data;
+
+    auto extDataIface = std::make_unique<extData::MockExternalDataIFaces>();
+    extData::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<extData::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(extData::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "File to test the trickle of debounced writes"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"},
+           {"Debounce", "PT0.5S"},
+           {"DebounceMaxLatency", "PT1S"}}}}};
+
+    fs::path srcPath{jsonData["Files"][0]["Path"]};
+    fs::path destDir{jsonData["Files"][0]["DestinationPath"]};
+    fs::path destPath = destDir / fs::relative(srcPath, "/");
+
+    writeConfig(jsonData);
+    auto ctx = std::make_shared<sdbusplus::async::context>();
+
+    ManagerTest::writeData(srcPath, "Src: Initial Data\n");
+
+    auto manager = std::make_shared<data_sync::Manager>(
+        *ctx, std::move(extDataIface), ManagerTest::dataSyncCfgDir);
+
+    // NOLINTNEXTLINE
+    auto triggerAndWatchSyncOp = [manager, srcPath, destPath,
+                                  ctx]() -> sdbusplus::async::task<void> {
+        // Wait for full sync to complete
+        auto status = manager->getFullSyncStatus();
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            status = manager->getFullSyncStatus();
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        auto getSyncs = [manager]() {
+            return manager
+                ->getSyncStats(data_sync::async::SyncPriority::Immediate)
+                ._granted;
+        };
+        const auto initialSyncs = getSyncs();
+
+        // The writes never settle for the window, but the max latency from
+        // the first write flushes them.
+        std::string dataToWrite;
+        for (size_t count = 0; count < 8; ++count)
+        {
+            dataToWrite = "Data is modified " + std::to_string(count);
+            ManagerTest::writeData(srcPath, dataToWrite);
+            co_await sdbusplus::async::sleep_for(
+                *ctx, std::chrono::milliseconds(200));
+        }
+        EXPECT_GE(getSyncs() - initialSyncs, 1);
+        EXPECT_NE(ManagerTest::readData(destPath), "Src: Initial Data\n");
+
+        // The last writes are flushed once settled.
+        co_await sdbusplus::async::sleep_for(*ctx, 1500ms);
+        EXPECT_EQ(ManagerTest::readData(destPath), dataToWrite);
+        EXPECT_LT(getSyncs() - initialSyncs, 8);
+
+        // Force an inotify event so running immediate sync tasks wake up
+        // handle the last write, and exit once the context stop is
+        // requested
+        ManagerTest::writeData(srcPath, "Dummy data to stop ctx");
+        ctx->request_stop();
+    };
+
+    ctx->spawn(triggerAndWatchSyncOp());
+    ctx->run();
+}
+
+TEST_F(ManagerTest, testDataChangesAcrossConfigsSyncedAsOneBatch)
+{
+    using namespace std::literals;
+    namespace extData = data_sync::ext_data;
+
+    auto extDataIface = std::make_unique<extData::MockExternalDataIFaces>();
+    extData::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<extData::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(extData::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    const fs::path srcDir1{ManagerTest::tmpDataSyncDataDir / "srcDir1"};
+    const fs::path srcDir2{ManagerTest::tmpDataSyncDataDir / "srcDir2"};
+
+    // The configurations of the same destination and exclude list are synced
+    // by the same rsync.
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", srcDir1.string() + "/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "First directory to test the batched sync"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}},
+          {{"Path", srcDir2.string() + "/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Second directory to test the batched sync"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    writeConfig(jsonData);
+    auto ctx = std::make_shared<sdbusplus::async::context>();
+
+    fs::create_directories(srcDir1);
+    fs::create_directories(srcDir2);
+    const std::vector<fs::path> srcFiles{srcDir1 / "file1", srcDir1 / "file2",
+                                         srcDir2 / "file3"};
+    for (const auto& srcFile : srcFiles)
+    {
+        ManagerTest::writeData(srcFile, "Src: Initial Data\n");
+    }
+
+    auto manager = std::make_shared<data_sync::Manager>(
+        *ctx, std::move(extDataIface), ManagerTest::dataSyncCfgDir);
+
+    // NOLINTNEXTLINE
+    auto triggerAndWatchSyncOp = [manager, srcFiles,
+                                  ctx]() -> sdbusplus::async::task<void> {
+        // Wait for full sync to complete
+        auto status = manager->getFullSyncStatus();
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            status = manager->getFullSyncStatus();
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        // Delay to finish the watches setup
+        co_await sdbusplus::async::sleep_for(*ctx, 1s);
+
+        auto getSyncs = [manager]() {
+            return manager
+                ->getSyncStats(data_sync::async::SyncPriority::Immediate)
+                ._granted;
+        };
+        const auto initialSyncs = getSyncs();
+
+        // All the writes are queued before the next wakeup of the watcher.
+        for (const auto& srcFile : srcFiles)
+        {
+            ManagerTest::writeData(srcFile, "Data is modified");
+        }
+
+        auto isSynced = [](const fs::path& srcFile) {
+            return ManagerTest::readData(ManagerTest::destDir /
+                                         fs::relative(srcFile, "/")) ==
+                   "Data is modified";
+        };
+        for (size_t count = 0;
+             count < 40 && !std::ranges::all_of(srcFiles, isSynced); ++count)
+        {
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        EXPECT_TRUE(std::ranges::all_of(srcFiles, isSynced));
+
+        // The paths across the configurations are synced by the rsync fed
+        // with the list of the paths via stdin.
+        EXPECT_EQ(getSyncs() - initialSyncs, 1);
+
+        // Force an inotify event so running immediate sync tasks wake up
+        // handle the last write, and exit once the context stop is
+        // requested
+        ManagerTest::writeData(srcFiles.front(), "Dummy data to stop ctx");
+        ctx->request_stop();
+    };
+
+    ctx->spawn(triggerAndWatchSyncOp());
+    ctx->run();
+}
+
+TEST_F(ManagerTest, testDataChangeWhileSyncIsInProgress)
+{
+    using namespace std::literals;
+    namespace extData = data_sync::ext_data;
+
+    auto extDataIface = std::make_unique<extData::MockExternalDataIFaces>();
+    extData::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<extData::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        .WillByDefault([mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(extData::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    EXPECT_CALL(*mockExtDataIfaces,
+                createErrorLog(testing::_, testing::_, testing::_, testing::_))
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    const fs::path srcDir{ManagerTest::tmpDataSyncDataDir / "srcDir"};
+    nlohmann::json jsonData = {
+        {"Directories",
+         {{{"Path", srcDir.string() + "/"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Directory to test the data change while syncing"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Immediate"}}}}};
+
+    writeConfig(jsonData);
+    auto ctx = std::make_shared<sdbusplus::async::context>();
+
+    // The files are large enough for the sync to be caught in progress.
+    fs::create_directories(srcDir);
+    const std::vector<fs::path> srcFiles{srcDir / "file1", srcDir / "file2"};
+    std::mt19937 generator{std::random_device{}()};
+    std::string data(64 * 1024 * 1024, '\0');
+    std::ranges::generate(data, [&generator]() {
+        return static_cast<char>(generator());
+    });
+    for (const auto& srcFile : srcFiles)
+    {
+        ManagerTest::writeData(srcFile, data);
+    }
+
+    auto manager = std::make_shared<data_sync::Manager>(
+        *ctx, std::move(extDataIface), ManagerTest::dataSyncCfgDir);
+
+    // NOLINTNEXTLINE
+    auto triggerAndWatchSyncOp = [manager, srcFiles,
+                                  ctx]() -> sdbusplus::async::task<void> {
+        // Wait for full sync to complete
+        auto status = manager->getFullSyncStatus();
+        while (status != FullSyncStatus::FullSyncCompleted &&
+               status != FullSyncStatus::FullSyncFailed)
+        {
+            status = manager->getFullSyncStatus();
+            co_await sdbusplus::async::sleep_for(*ctx,
+                                                 std::chrono::milliseconds(50));
+        }
+        // Delay to finish the watches setup
+        co_await sdbusplus::async::sleep_for(*ctx, 1s);
+
+        auto getStats = [manager]() {
+            return manager->getSyncStats(
+                data_sync::async::SyncPriority::Immediate);
+        };
+
+        // Append to the file, so the file never shrinks under the running
+        // rsync and the size differs from the destination.
+        auto appendData = [](const fs::path& srcFile, const std::string& data) {
+            std::ofstream(srcFile, std::ios::app | std::ios::binary) << data;
+        };
+
+        auto isSynced = [](const fs::path& srcFile) {
+            std::ifstream src(srcFile, std::ios::binary);
+            std::ifstream dest(ManagerTest::destDir /
+                                   fs::relative(srcFile, "/"),
+                               std::ios::binary);
+            return std::equal(std::istreambuf_iterator<char>(src),
+                              std::istreambuf_iterator<char>(),
+                              std::istreambuf_iterator<char>(dest),
+                              std::istreambuf_iterator<char>());
+        };
+
+        // Modify the given files once their sync is in progress and wait
+        // until the final data reaches the destination.
+        // NOLINTNEXTLINE
+        auto modifyWhileSyncing = [ctx, getStats, appendData, isSynced](
+                                      const std::vector<fs::path>& files)
+            -> sdbusplus::async::task<size_t> {
+            const auto initialSyncs = getStats()._granted;
+
+            for (const auto& file : files)
+            {
+                appendData(file, "First modification");
+            }
+
+            for (size_t count = 0; count < 1000 && getStats()._running == 0;
+                 ++count)
+            {
+                co_await sdbusplus::async::sleep_for(
+                    *ctx, std::chrono::milliseconds(1));
+            }
+            EXPECT_GT(getStats()._running, 0);
+
+            for (const auto& file : files)
+            {
+                appendData(file, "Final modification");
+            }
+
+            for (size_t count = 0;
+                 count < 200 && (getStats()._running != 0 ||
+                                 !std::ranges::all_of(files, isSynced));
+                 ++count)
+            {
+                co_await sdbusplus::async::sleep_for(
+                    *ctx, std::chrono::milliseconds(100));
+            }
+            EXPECT_TRUE(std::ranges::all_of(files, isSynced));
+
+            co_return getStats()._granted - initialSyncs;
+        };
+
+        // A single path is synced once again after the in-progress sync.
+        // NOLINTNEXTLINE
+        auto syncs = co_await modifyWhileSyncing({srcFiles.front()});
+        EXPECT_EQ(syncs, 2);
+
+        // The paths of a batch modified during the sync are re-batched into
+        // one more rsync.
+        // NOLINTNEXTLINE
+        syncs = co_await modifyWhileSyncing(srcFiles);
+        EXPECT_EQ(syncs, 2);
+
+        // Force an inotify event so running immediate sync tasks wake up
+        // handle the last write, and exit once the context stop is
+        // requested
+        ManagerTest::writeData(srcFiles.front(), "Dummy data to stop ctx");
+        ctx->request_stop();
+    };
+
+    ctx->spawn(triggerAndWatchSyncOp());
+    ctx->run();
+}
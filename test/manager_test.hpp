@@ -19,6 +19,16 @@ class ManagerTest : public ::testing::Test
         tmpDataSyncDataDir = mkdtemp(tmpDataDir);
         data_sync::persist::DBusPropDataFile = tmpDataSyncDataDir /
                                                "persistentData.json";
+        data_sync::persist::SyncJournalFile = tmpDataSyncDataDir /
+                                              "syncJournal";
+        data_sync::persist::FullSyncStatsFile = tmpDataSyncDataDir /
+                                                "fullSyncStats.json";
+        data_sync::persist::FullSyncCheckpointFile =
+            tmpDataSyncDataDir / "fullSyncCheckpoint.json";
+        data_sync::persist::ReceivedDigestsFile = tmpDataSyncDataDir /
+                                                  "receivedDigests.json";
+        data_sync::persist::SiblingDigestsFile = tmpDataSyncDataDir /
+                                                 "siblingDigests.json";
     }
 
     // Set up each individual test
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "path_matcher.hpp"
+
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+using data_sync::config::PathMatcher;
+
+TEST(PathMatcherTest, TestAbsolutePaths)
+{
+    PathMatcher pathMatcher({"/dir1/subDir/", "/dir1/file"});
+
+    // Same path
+    EXPECT_TRUE(pathMatcher.matches("/dir1/subDir/", true));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/subDir", true));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/file", false));
+
+    // Child paths
+    EXPECT_TRUE(pathMatcher.matches("/dir1/subDir/file", false));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/subDir/dir2/", true));
+
+    // Compared component wise
+    EXPECT_FALSE(pathMatcher.matches("/dir1/subDir2", true));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/file1", false));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/", true));
+
+    // The trailing slash matches only directories
+    EXPECT_FALSE(pathMatcher.matches("/dir1/subDir", false));
+
+    EXPECT_EQ(pathMatcher.getPaths(),
+              (std::vector<fs::path>{"/dir1/file", "/dir1/subDir/"}));
+}
+
+TEST(PathMatcherTest, TestParentOfPattern)
+{
+    PathMatcher pathMatcher({"/dir1/subDir/dir2/"});
+
+    EXPECT_TRUE(pathMatcher.isParentOfPattern("/dir1"));
+    EXPECT_TRUE(pathMatcher.isParentOfPattern("/dir1/subDir/"));
+    EXPECT_FALSE(pathMatcher.isParentOfPattern("/dir1/subDir/dir2/"));
+    EXPECT_FALSE(pathMatcher.isParentOfPattern("/dir1/subDir2/"));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/subDir/", true));
+}
+
+TEST(PathMatcherTest, TestGlobPatterns)
+{
+    PathMatcher pathMatcher({"*.tmp", "**/cache/", "/dir1/*/logs"});
+
+    // Relative patterns are matched at any depth
+    EXPECT_TRUE(pathMatcher.matches("/file.tmp", false));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/dir2/file.tmp", false));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/dir2/file.tmp1", false));
+
+    EXPECT_TRUE(pathMatcher.matches("/dir1/cache", true));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/dir2/cache/file", false));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/cache", false));
+
+    // Glob component in an absolute pattern
+    EXPECT_TRUE(pathMatcher.matches("/dir1/dir2/logs", false));
+    EXPECT_TRUE(pathMatcher.matches("/dir1/dir2/logs/file", false));
+    EXPECT_FALSE(pathMatcher.matches("/dir1/logs", false));
+
+    // Glob patterns are not listed as paths
+    EXPECT_TRUE(pathMatcher.getPaths().empty());
+
+    // Copy has the same compiled patterns
+    PathMatcher copied(pathMatcher);
+    EXPECT_TRUE(copied.matches("/dir1/dir2/file.tmp", false));
+}
@@ -594,3 +594,181 @@ TEST_F(ManagerTest, PeriodicDataSyncTestWithExcludeList)
         sdbusplus::async::execution::then([&ctx]() { ctx.request_stop(); }));
     ctx.run();
 }
+
+/*
+ * Test the periodic sync skips the ticks while the data is not changed and
+ * backs off the interval, and syncs once the data is changed.
+ */
+TEST_F(ManagerTest, PeriodicDataSyncSkipUnchangedTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile1"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Parse test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"},
+           {"MaxPeriodicity", "PT4S"}}}}};
+
+    fs::path srcFile{jsonData["Files"][0]["Path"]};
+    fs::path destDir{jsonData["Files"][0]["DestinationPath"]};
+    fs::path destFile = destDir / fs::relative(srcFile, "/");
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    std::string data{"Initial Data\n"};
+    ManagerTest::writeData(srcFile, data);
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir};
+
+    std::string tamperedData{"Tampered Data\n"};
+    std::string updatedData{"Data got updated\n"};
+    auto verifySkippedTicks =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        // Synced by the first tick.
+        co_await sdbusplus::async::sleep_for(ctx, 1.5s);
+        EXPECT_EQ(ManagerTest::readData(destFile), data);
+
+        // The tick at 2 seconds is skipped as the source is not changed, so
+        // the destination is not restored and the next tick is at 4
+        // seconds.
+        ManagerTest::writeData(destFile, tamperedData);
+        co_await sdbusplus::async::sleep_for(ctx, 1s);
+        EXPECT_EQ(ManagerTest::readData(destFile), tamperedData);
+
+        ManagerTest::writeData(srcFile, updatedData);
+        co_await sdbusplus::async::sleep_for(ctx, 0.5s);
+        EXPECT_EQ(ManagerTest::readData(destFile), tamperedData)
+            << "The interval is backed off to 2 seconds";
+
+        co_await sdbusplus::async::sleep_for(ctx, 1.5s);
+        EXPECT_EQ(ManagerTest::readData(destFile), updatedData);
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(verifySkippedTicks(ctx));
+    ctx.run();
+}
+
+/*
+ * Test the periodic syncs of the multiple configurations which fire together
+ * are synced, including the ones which can't be batched with the rest.
+ */
+TEST_F(ManagerTest, PeriodicDataSyncBatchedTest)
+{
+    using namespace std::literals;
+    namespace ed = data_sync::ext_data;
+
+    std::unique_ptr<ed::ExternalDataIFaces> extDataIface =
+        std::make_unique<ed::MockExternalDataIFaces>();
+
+    ed::MockExternalDataIFaces* mockExtDataIfaces =
+        dynamic_cast<ed::MockExternalDataIFaces*>(extDataIface.get());
+
+    ON_CALL(*mockExtDataIfaces, fetchBMCRedundancyMgrProps())
+        // NOLINTNEXTLINE
+        .WillByDefault([&mockExtDataIfaces]() -> sdbusplus::async::task<> {
+        mockExtDataIfaces->setBMCRole(ed::BMCRole::Active);
+        mockExtDataIfaces->setBMCRedundancy(true);
+        co_return;
+    });
+
+    EXPECT_CALL(*mockExtDataIfaces, fetchBMCPosition())
+        // NOLINTNEXTLINE
+        .WillRepeatedly([]() -> sdbusplus::async::task<> { co_return; });
+
+    const auto otherDestDir = ManagerTest::tmpDataSyncDataDir / "otherDestDir";
+    nlohmann::json jsonData = {
+        {"Files",
+         {{{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile1"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Parse test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile2"},
+           {"DestinationPath", ManagerTest::destDir.string()},
+           {"Description", "Parse test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"}},
+          {{"Path", ManagerTest::tmpDataSyncDataDir.string() + "/srcFile3"},
+           {"DestinationPath", otherDestDir.string()},
+           {"Description", "Parse test file"},
+           {"SyncDirection", "Active2Passive"},
+           {"SyncType", "Periodic"},
+           {"Periodicity", "PT1S"}}}}};
+
+    std::vector<std::pair<fs::path, fs::path>> files;
+    for (const auto& file : jsonData["Files"])
+    {
+        fs::path srcFile{file["Path"]};
+        fs::path destDir{file["DestinationPath"]};
+        files.emplace_back(srcFile, destDir / fs::relative(srcFile, "/"));
+    }
+    fs::create_directory(otherDestDir);
+
+    writeConfig(jsonData);
+    sdbusplus::async::context ctx;
+
+    std::string data{"Initial Data\n"};
+    for (const auto& srcFile : files | std::views::keys)
+    {
+        ManagerTest::writeData(srcFile, data);
+    }
+
+    data_sync::Manager manager{ctx, std::move(extDataIface),
+                               ManagerTest::dataSyncCfgDir};
+
+    std::string updatedData{"Data got updated\n"};
+    auto verifyBatchedSync =
+        // NOLINTNEXTLINE
+        [&](sdbusplus::async::context& ctx) -> sdbusplus::async::task<void> {
+        co_await sdbusplus::async::sleep_for(ctx, 1.5s);
+        for (const auto& [srcFile, destFile] : files)
+        {
+            EXPECT_EQ(ManagerTest::readData(destFile), data);
+            ManagerTest::writeData(srcFile, updatedData);
+        }
+
+        // All the configurations tick together at 2 seconds.
+        co_await sdbusplus::async::sleep_for(ctx, 1.2s);
+        for (const auto& destFile : files | std::views::values)
+        {
+            EXPECT_EQ(ManagerTest::readData(destFile), updatedData);
+        }
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(verifyBatchedSync(ctx));
+    ctx.run();
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "retry_queue.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::async::RetryOutcome;
+using data_sync::async::RetryQueue;
+
+TEST(RetryQueueTest, TestBackoffDoublesUpToMaxWithJitter)
+{
+    using namespace std::literals;
+
+    for (size_t count = 0; count < 100; ++count)
+    {
+        auto backoff = RetryQueue::getBackoff(2s, 1, 10s);
+        EXPECT_GE(backoff, 1s);
+        EXPECT_LE(backoff, 2s);
+
+        backoff = RetryQueue::getBackoff(2s, 3, 10s);
+        EXPECT_GE(backoff, 4s);
+        EXPECT_LE(backoff, 8s);
+
+        // Capped to the max interval.
+        backoff = RetryQueue::getBackoff(2s, 10, 10s);
+        EXPECT_GE(backoff, 5s);
+        EXPECT_LE(backoff, 10s);
+
+        // The retry interval longer than the max interval is kept.
+        backoff = RetryQueue::getBackoff(20s, 2, 10s);
+        EXPECT_GE(backoff, 10s);
+        EXPECT_LE(backoff, 20s);
+    }
+}
+
+TEST(RetryQueueTest, TestRetriesOfSamePathCoalesce)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    RetryQueue retryQueue(ctx);
+    std::vector<RetryOutcome> outcomes;
+
+    // NOLINTNEXTLINE
+    auto retryJob = [&](std::chrono::milliseconds backoff,
+                        bool synced) -> sdbusplus::async::task<> {
+        // NOLINTNEXTLINE
+        auto outcome = co_await retryQueue.wait("/cfg", "/cfg/file", backoff);
+        outcomes.emplace_back(outcome);
+        if (outcome == RetryOutcome::Due)
+        {
+            retryQueue.complete("/cfg", "/cfg/file", synced);
+        }
+        if (outcomes.size() == 2)
+        {
+            ctx.request_stop();
+        }
+    };
+
+    // The second job joins the retry of the first one, which is due first.
+    ctx.spawn(retryJob(10ms, true));
+    ctx.spawn(retryJob(5s, false));
+
+    ctx.run();
+
+    EXPECT_EQ(outcomes, (std::vector<RetryOutcome>{RetryOutcome::Due,
+                                                   RetryOutcome::Synced}));
+    EXPECT_EQ(retryQueue.getPendingCount(), 0);
+}
+
+TEST(RetryQueueTest, TestRetriesFoldedIntoSync)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    RetryQueue retryQueue(ctx);
+    std::vector<RetryOutcome> outcomes;
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // NOLINTNEXTLINE
+    auto retryJob = [&](std::filesystem::path path,
+                        std::chrono::milliseconds backoff)
+        -> sdbusplus::async::task<> {
+        // NOLINTNEXTLINE
+        auto outcome = co_await retryQueue.wait("/cfg", path, backoff);
+        outcomes.emplace_back(outcome);
+        if (outcome == RetryOutcome::Due)
+        {
+            retryQueue.complete("/cfg", path, true);
+        }
+        if (outcomes.size() == 2)
+        {
+            ctx.request_stop();
+        }
+    };
+
+    // NOLINTNEXTLINE
+    auto syncJob = [&]() -> sdbusplus::async::task<> {
+        co_await sdbusplus::async::sleep_for(ctx, 10ms);
+
+        // The failed sync of the folded retries queues them again.
+        auto foldedRetries = retryQueue.fold("/cfg");
+        EXPECT_EQ(foldedRetries.size(), 2);
+        EXPECT_TRUE(retryQueue.fold("/cfg").empty());
+        for (const auto& path : foldedRetries)
+        {
+            retryQueue.complete("/cfg", path, path == "/cfg/dir");
+        }
+    };
+
+    ctx.spawn(retryJob("/cfg/file", 100ms));
+    ctx.spawn(retryJob("/cfg/dir", 5s));
+    ctx.spawn(syncJob());
+
+    ctx.run();
+
+    EXPECT_EQ(outcomes, (std::vector<RetryOutcome>{RetryOutcome::Synced,
+                                                   RetryOutcome::Due}));
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, 5s);
+    EXPECT_EQ(retryQueue.getPendingCount(), 0);
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rsync_job.hpp"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::rsync::RsyncJob;
+
+namespace
+{
+
+std::vector<std::string> getArgs(const RsyncJob& job)
+{
+    auto argv = job.getArgv();
+    EXPECT_EQ(argv.back(), nullptr);
+    return {argv.begin(), argv.end() - 1};
+}
+
+} // namespace
+
+TEST(RsyncJobTest, TestSourcesAddedBeforeDestination)
+{
+    const RsyncJob jobTemplate({"--recursive", "--filter=- *.tmp"},
+                               "rsync://localhost:873/module/dest");
+
+    auto job = jobTemplate;
+    job.addSource("/path with space/file'name").addSource("/path/dir");
+
+    EXPECT_FALSE(jobTemplate.hasSources());
+    EXPECT_TRUE(job.hasSources());
+
+    // The arguments are passed as they are without any quoting.
+    EXPECT_EQ(getArgs(job),
+              (std::vector<std::string>{
+                  "rsync", "--recursive", "--filter=- *.tmp",
+                  "/path with space/file'name", "/path/dir",
+                  "rsync://localhost:873/module/dest"}));
+
+    // The template is not modified by its copies.
+    EXPECT_EQ(getArgs(jobTemplate),
+              (std::vector<std::string>{"rsync", "--recursive",
+                                        "--filter=- *.tmp",
+                                        "rsync://localhost:873/module/dest"}));
+}
+
+TEST(RsyncJobTest, TestEmptyDestinationNotPassed)
+{
+    RsyncJob job({"--times"}, "");
+    job.addSource("/path/file");
+
+    EXPECT_EQ(getArgs(job),
+              (std::vector<std::string>{"rsync", "--times", "/path/file"}));
+    EXPECT_EQ(job.toString(), "rsync --times /path/file");
+}
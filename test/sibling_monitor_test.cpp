@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sibling_monitor.hpp"
+#include "utility.hpp"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::async::SiblingMonitor;
+
+class SiblingMonitorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Listen on an ephemeral loopback port as the stunnel client would.
+        _listenFd = data_sync::utility::FD{
+            socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+        ASSERT_GE(_listenFd(), 0);
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_EQ(bind(_listenFd(), reinterpret_cast<sockaddr*>(&address),
+                       sizeof(address)),
+                  0);
+        ASSERT_EQ(listen(_listenFd(), 4), 0);
+
+        socklen_t length = sizeof(address);
+        ASSERT_EQ(getsockname(_listenFd(),
+                              reinterpret_cast<sockaddr*>(&address), &length),
+                  0);
+        _port = ntohs(address.sin_port);
+    }
+
+    /**
+     * @brief Accept the pending probe and greet it as the rsync daemon.
+     */
+    void greet()
+    {
+        data_sync::utility::FD connFd{accept(_listenFd(), nullptr, nullptr)};
+        if (connFd() >= 0)
+        {
+            constexpr std::string_view greeting{"@RSYNCD: 31.0\n"};
+            EXPECT_EQ(write(connFd(), greeting.data(), greeting.size()),
+                      static_cast<ssize_t>(greeting.size()));
+        }
+    }
+
+    data_sync::utility::FD _listenFd{-1};
+    uint16_t _port{0};
+};
+
+TEST_F(SiblingMonitorTest, TestProbeReachability)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    std::vector<bool> changes;
+    SiblingMonitor monitor(
+        ctx, _port,
+        [&changes](bool reachable) { changes.push_back(reachable); }, 30s, 5s,
+        500ms);
+
+    // NOLINTNEXTLINE
+    auto probeJob = [&]() -> sdbusplus::async::task<> {
+        // The connection is queued by the listener, greet it meanwhile.
+        ctx.spawn(sdbusplus::async::sleep_for(ctx, 50ms) |
+                  stdexec::then([this]() { greet(); }));
+        // NOLINTNEXTLINE
+        EXPECT_TRUE(co_await monitor.probe());
+        EXPECT_TRUE(changes.empty());
+
+        // The listener neither accepts nor greets, hence timed out.
+        // NOLINTNEXTLINE
+        EXPECT_FALSE(co_await monitor.probe());
+        EXPECT_EQ(changes, std::vector<bool>{false});
+
+        // Connections are refused once the listener is closed.
+        _listenFd.reset();
+        // NOLINTNEXTLINE
+        EXPECT_FALSE(co_await monitor.probe());
+        EXPECT_EQ(changes, std::vector<bool>{false});
+        EXPECT_FALSE(monitor.isReachable());
+
+        ctx.request_stop();
+    };
+
+    ctx.spawn(probeJob());
+    ctx.run();
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_journal.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+using data_sync::persist::SyncJournal;
+
+class SyncJournalTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/syncJournalTestXXXXXX";
+        testDir = mkdtemp(tmpdir);
+        journalFile = testDir / "syncJournal";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    static constexpr uint64_t configId = 1234;
+
+    fs::path testDir;
+    fs::path journalFile;
+};
+
+TEST_F(SyncJournalTest, TestPendingPathsReplayed)
+{
+    {
+        SyncJournal journal(journalFile);
+        EXPECT_FALSE(journal.load(configId).has_value());
+
+        // Not recorded until the journal is created
+        journal.record({"/dir1/file1"});
+        EXPECT_FALSE(fs::exists(journalFile));
+
+        journal.create(configId);
+        journal.record({"/dir1/file1", "/dir1/subDir/file2", "/dir2/file3"});
+
+        // The sub paths of the synced directory are trimmed
+        journal.trim("/dir1/", journal.sequence());
+    }
+
+    SyncJournal journal(journalFile);
+    auto pendingPaths = journal.load(configId);
+    ASSERT_TRUE(pendingPaths.has_value());
+    EXPECT_EQ(*pendingPaths, std::vector<fs::path>{"/dir2/file3"});
+
+    // The journal of a different configuration is not replayed
+    SyncJournal otherJournal(journalFile);
+    EXPECT_FALSE(otherJournal.load(configId + 1).has_value());
+    EXPECT_FALSE(fs::exists(journalFile));
+}
+
+TEST_F(SyncJournalTest, TestPathRecordedAgainDuringSyncNotTrimmed)
+{
+    SyncJournal journal(journalFile);
+    journal.create(configId);
+
+    journal.record({"/dir1/file1"});
+    auto syncStartSequence = journal.sequence();
+
+    // Modified again while the sync is in progress
+    journal.record({"/dir1/file1"});
+    journal.trim("/dir1/file1", syncStartSequence);
+
+    SyncJournal reloadedJournal(journalFile);
+    auto pendingPaths = reloadedJournal.load(configId);
+    ASSERT_TRUE(pendingPaths.has_value());
+    EXPECT_EQ(*pendingPaths, std::vector<fs::path>{"/dir1/file1"});
+}
+
+TEST_F(SyncJournalTest, TestTornRecord)
+{
+    {
+        SyncJournal journal(journalFile);
+        journal.create(configId);
+        journal.record({"/dir1/file1"});
+    }
+
+    // A torn trim is ignored since the path is synced again
+    std::ofstream(journalFile, std::ios::app) << "-1 /dir1/fi";
+    {
+        SyncJournal journal(journalFile);
+        auto pendingPaths = journal.load(configId);
+        ASSERT_TRUE(pendingPaths.has_value());
+        EXPECT_EQ(*pendingPaths, std::vector<fs::path>{"/dir1/file1"});
+    }
+
+    // A torn modified path requires a full sync
+    std::ofstream(journalFile, std::ios::app) << "+2 /dir1/fi";
+    SyncJournal journal(journalFile);
+    EXPECT_FALSE(journal.load(configId).has_value());
+    EXPECT_FALSE(fs::exists(journalFile));
+}
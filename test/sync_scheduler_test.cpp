@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sync_scheduler.hpp"
+
+#include <sdbusplus/async.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using data_sync::async::SyncPriority;
+using data_sync::async::SyncScheduler;
+
+TEST(SyncSchedulerTest, TestSlotsGrantedByPriorityAndFairness)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    SyncScheduler scheduler(ctx, 1);
+    std::vector<std::string> runOrder;
+
+    // NOLINTNEXTLINE
+    auto syncJob = [&](SyncPriority priority, std::string cfgPath,
+                       std::string jobName) -> sdbusplus::async::task<> {
+        // NOLINTNEXTLINE
+        auto slot = co_await scheduler.acquire(priority, cfgPath);
+        runOrder.emplace_back(std::move(jobName));
+        EXPECT_EQ(scheduler.getStats(priority)._running, 1);
+
+        co_await sdbusplus::async::sleep_for(ctx, 10ms);
+        if (runOrder.size() == 6)
+        {
+            ctx.request_stop();
+        }
+    };
+
+    // The first job gets the only slot and the rest wait for it.
+    ctx.spawn(syncJob(SyncPriority::FullSync, "/cfg1", "full1"));
+    ctx.spawn(syncJob(SyncPriority::FullSync, "/cfg1", "full2"));
+    ctx.spawn(syncJob(SyncPriority::Periodic, "/cfg2", "periodic"));
+    ctx.spawn(syncJob(SyncPriority::Immediate, "/cfg3", "immediate1"));
+    ctx.spawn(syncJob(SyncPriority::Immediate, "/cfg3", "immediate2"));
+    ctx.spawn(syncJob(SyncPriority::Immediate, "/cfg4", "immediate3"));
+
+    ctx.run();
+
+    EXPECT_EQ(runOrder,
+              (std::vector<std::string>{"full1", "immediate1", "immediate3",
+                                        "immediate2", "periodic", "full2"}));
+    EXPECT_EQ(scheduler.getStats(SyncPriority::Immediate)._granted, 3);
+    EXPECT_EQ(scheduler.getStats(SyncPriority::Immediate)._maxQueued, 3);
+    EXPECT_EQ(scheduler.getStats(SyncPriority::FullSync)._queued, 0);
+}
+
+TEST(SyncSchedulerTest, TestLastSlotKeptForImmediateSync)
+{
+    using namespace std::literals;
+
+    sdbusplus::async::context ctx;
+    SyncScheduler scheduler(ctx, 2);
+    bool immediateSynced{false};
+
+    // NOLINTNEXTLINE
+    auto fullSyncJob = [&]() -> sdbusplus::async::task<> {
+        // NOLINTNEXTLINE
+        auto slot = co_await scheduler.acquire(SyncPriority::FullSync, "/cfg1");
+        co_await sdbusplus::async::sleep_for(ctx, 50ms);
+
+        // The Immediate job isn't delayed by the full sync jobs.
+        EXPECT_TRUE(immediateSynced);
+        ctx.request_stop();
+    };
+
+    // NOLINTNEXTLINE
+    auto immediateJob = [&]() -> sdbusplus::async::task<> {
+        // NOLINTNEXTLINE
+        auto slot = co_await scheduler.acquire(SyncPriority::Immediate,
+                                               "/cfg2");
+        immediateSynced = true;
+    };
+
+    // The second full sync job waits for the first one.
+    ctx.spawn(fullSyncJob());
+    ctx.spawn(fullSyncJob());
+    ctx.spawn(immediateJob());
+    ctx.run();
+
+    EXPECT_EQ(scheduler.getStats(SyncPriority::FullSync)._maxQueued, 1);
+}
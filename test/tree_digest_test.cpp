@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tree_digest.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+namespace digest = data_sync::digest;
+
+class TreeDigestTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/treeDigestTestXXXXXX";
+        testDir = mkdtemp(tmpdir);
+        fs::create_directories(testDir / "dir1" / "subDir");
+        fs::create_directories(testDir / "dir2");
+        writeData(testDir / "dir1" / "subDir" / "file", "Data in dir1");
+        writeData(testDir / "dir2" / "file", "Data in dir2");
+        writeData(testDir / "file", "Data in top level");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    static void writeData(const fs::path& path, const std::string& data)
+    {
+        std::ofstream(path) << data;
+    }
+
+    fs::path testDir;
+};
+
+TEST_F(TreeDigestTest, TestSubtreeDigests)
+{
+    auto digests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(digests.has_value());
+    EXPECT_EQ(digests->size(), 3);
+    EXPECT_TRUE(digests->contains(digest::rootKey));
+    EXPECT_TRUE(digests->contains("dir1"));
+    EXPECT_TRUE(digests->contains("dir2"));
+
+    // The digests are stable if nothing is changed.
+    EXPECT_EQ(digest::getSubtreeDigests(testDir, std::nullopt), digests);
+}
+
+TEST_F(TreeDigestTest, TestChangedSubtree)
+{
+    auto digests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(digests.has_value());
+
+    // The change in a nested file changes only its top level subtree.
+    writeData(testDir / "dir1" / "subDir" / "file", "Modified data in dir1");
+    auto changedDigests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(changedDigests.has_value());
+    EXPECT_NE(changedDigests->at("dir1"), digests->at("dir1"));
+    EXPECT_EQ(changedDigests->at("dir2"), digests->at("dir2"));
+    EXPECT_EQ(changedDigests->at(digest::rootKey),
+              digests->at(digest::rootKey));
+
+    // The removed subdirectory changes the top level.
+    fs::remove_all(testDir / "dir2");
+    changedDigests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(changedDigests.has_value());
+    EXPECT_FALSE(changedDigests->contains("dir2"));
+    EXPECT_NE(changedDigests->at(digest::rootKey),
+              digests->at(digest::rootKey));
+}
+
+TEST_F(TreeDigestTest, TestExcludedPaths)
+{
+    auto digests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(digests.has_value());
+
+    // The changes in the excluded paths don't change the digests.
+    data_sync::config::PathMatcher excludeMatcher(
+        {testDir / "dir1" / "subDir"});
+    auto excludedDigests = digest::getSubtreeDigests(testDir, excludeMatcher);
+    ASSERT_TRUE(excludedDigests.has_value());
+    writeData(testDir / "dir1" / "subDir" / "file", "Modified data in dir1");
+    EXPECT_EQ(digest::getSubtreeDigests(testDir, excludeMatcher),
+              excludedDigests);
+}
+
+TEST_F(TreeDigestTest, TestMissingDirectory)
+{
+    EXPECT_FALSE(digest::getSubtreeDigests(testDir / "missing", std::nullopt)
+                     .has_value());
+}
+
+TEST_F(TreeDigestTest, TestDigestedInSlices)
+{
+    auto digests = digest::getSubtreeDigests(testDir, std::nullopt);
+    ASSERT_TRUE(digests.has_value());
+
+    // The digests are known only once the whole tree is walked.
+    digest::TreeDigester digester(testDir, std::nullopt);
+    size_t slices{0};
+    while (!digester.done())
+    {
+        EXPECT_FALSE(digester.getSubtreeDigests().has_value());
+        digester.walk(1);
+        ++slices;
+    }
+    EXPECT_GT(slices, 1);
+    EXPECT_EQ(digester.getSubtreeDigests(), digests);
+}
+
+TEST_F(TreeDigestTest, TestPathDigest)
+{
+    auto getPathDigest = [](const fs::path& path) {
+        digest::TreeDigester digester(path, std::nullopt);
+        digester.walk(std::numeric_limits<size_t>::max());
+        return digest::getPathDigest(path, digester.getTreeDigest());
+    };
+
+    auto pathDigest = getPathDigest(testDir / "dir1");
+    EXPECT_EQ(getPathDigest(testDir / "dir1"), pathDigest);
+
+    // The change in a nested file changes the digest of the whole tree.
+    writeData(testDir / "dir1" / "subDir" / "file", "Modified data in dir1");
+    auto changedDigest = getPathDigest(testDir / "dir1");
+    EXPECT_NE(changedDigest, pathDigest);
+
+    // The removal is a change too.
+    fs::remove_all(testDir / "dir1");
+    EXPECT_NE(getPathDigest(testDir / "dir1"), changedDigest);
+}
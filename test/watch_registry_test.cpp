@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config.h"
+
+#include "data_watcher.hpp"
+#include "inotify_watcher.hpp"
+#include "utility.hpp"
+#include "watch_registry.hpp"
+
+#include <sys/inotify.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+namespace inotify = data_sync::watch::inotify;
+
+class WatchRegistryTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/watchRegistryTestXXXXXX";
+        testDir = mkdtemp(tmpdir);
+        fs::create_directories(testDir / "dir1" / "subDir");
+        fs::create_directories(testDir / "dir2");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(testDir);
+    }
+
+    static constexpr uint32_t eventMasksToWatch =
+        IN_CLOSE_WRITE | IN_MOVE | IN_DELETE_SELF | IN_CREATE | IN_DELETE;
+
+    static constexpr size_t maxWatches = std::numeric_limits<size_t>::max();
+
+    fs::path testDir;
+};
+
+TEST_F(WatchRegistryTest, TestWatchesSharedAcrossDataWatchers)
+{
+    sdbusplus::async::context ctx;
+    inotify::WatchRegistry registry(ctx, IN_NONBLOCK);
+
+    {
+        // Watches testDir, dir1, dir1/subDir and dir2
+        inotify::DataWatcher dataWatcher1(registry, eventMasksToWatch,
+                                          testDir / "");
+        dataWatcher1.addPendingWatches(maxWatches);
+        EXPECT_EQ(registry.watchCount(), 4);
+
+        // Watches dir1 and dir1/subDir which are already watched
+        inotify::DataWatcher dataWatcher2(registry, eventMasksToWatch,
+                                          testDir / "dir1" / "");
+        dataWatcher2.addPendingWatches(maxWatches);
+        EXPECT_EQ(registry.watchCount(), 4);
+        EXPECT_EQ(dataWatcher2.getWatchingPaths().size(), 2);
+    }
+
+    // All the watches are removed with the last subscriber
+    EXPECT_EQ(registry.watchCount(), 0);
+}
+
+TEST_F(WatchRegistryTest, TestSubDirWatchesAddedInSlices)
+{
+    sdbusplus::async::context ctx;
+    inotify::WatchRegistry registry(ctx, IN_NONBLOCK);
+
+    // Only the configured path is watched on construction
+    inotify::DataWatcher dataWatcher(registry, eventMasksToWatch,
+                                     testDir / "");
+    EXPECT_EQ(registry.watchCount(), 1);
+    EXPECT_TRUE(dataWatcher.hasPendingWatches());
+    EXPECT_TRUE(registry.hasPendingWatches());
+
+    EXPECT_EQ(dataWatcher.addPendingWatches(1), 1);
+    EXPECT_EQ(registry.watchCount(), 2);
+    EXPECT_TRUE(dataWatcher.hasPendingWatches());
+
+    EXPECT_EQ(dataWatcher.addPendingWatches(maxWatches), 2);
+    EXPECT_EQ(registry.watchCount(), 4);
+    EXPECT_FALSE(dataWatcher.hasPendingWatches());
+}
+
+TEST_F(WatchRegistryTest, TestPathsRebuiltAfterParentRemoved)
+{
+    sdbusplus::async::context ctx;
+    inotify::WatchRegistry registry(ctx, IN_NONBLOCK);
+
+    auto dataWatcher1 = std::make_unique<inotify::DataWatcher>(
+        registry, eventMasksToWatch, testDir / "");
+    dataWatcher1->addPendingWatches(maxWatches);
+    inotify::DataWatcher dataWatcher2(registry, eventMasksToWatch,
+                                      testDir / "dir1" / "");
+    dataWatcher2.addPendingWatches(maxWatches);
+
+    auto subDirWd = registry.findWatch(testDir / "dir1" / "subDir");
+    ASSERT_TRUE(subDirWd.has_value());
+    EXPECT_EQ(registry.getPath(*subDirWd), testDir / "dir1" / "subDir" / "");
+
+    // The parent watch of dir1 is removed along with the first watcher
+    dataWatcher1.reset();
+    EXPECT_EQ(registry.watchCount(), 2);
+    EXPECT_FALSE(registry.findWatch(testDir).has_value());
+    EXPECT_EQ(registry.getPath(*subDirWd), testDir / "dir1" / "subDir" / "");
+
+    auto dir1Wd = registry.findWatch(testDir / "dir1");
+    ASSERT_TRUE(dir1Wd.has_value());
+    EXPECT_EQ(registry.getPath(*dir1Wd), testDir / "dir1" / "");
+}
+
+TEST_F(WatchRegistryTest, TestEventDispatchedToAllSubscribers)
+{
+    sdbusplus::async::context ctx;
+    inotify::InotifyWatcher inotifyWatcher(ctx);
+
+    auto subscriber1 = inotifyWatcher.subscribe(
+        eventMasksToWatch, testDir / "", std::nullopt, std::nullopt);
+    auto subscriber2 = inotifyWatcher.subscribe(
+        eventMasksToWatch, testDir / "dir1" / "", std::nullopt, std::nullopt);
+    auto subscriber3 = inotifyWatcher.subscribe(
+        eventMasksToWatch, testDir / "dir2" / "", std::nullopt, std::nullopt);
+
+    std::ofstream(testDir / "dir1" / "subDir" / "file") << "Data";
+
+    // NOLINTNEXTLINE
+    auto waitForDataChange = [&]() -> sdbusplus::async::task<void> {
+        // NOLINTNEXTLINE
+        auto dataChanges = co_await inotifyWatcher.onDataChange();
+
+        EXPECT_EQ(dataChanges.size(), 2);
+        for (const auto& [subscriberId, dataOperations] : dataChanges)
+        {
+            EXPECT_TRUE(subscriberId == subscriber1 ||
+                        subscriberId == subscriber2);
+            EXPECT_EQ(dataOperations.size(), 1);
+            for (const auto& dataOperation : dataOperations)
+            {
+                EXPECT_EQ(dataOperation._path,
+                          testDir / "dir1" / "subDir" / "file");
+                EXPECT_EQ(dataOperation._dataOp,
+                          data_sync::watch::DataOps::COPY);
+            }
+        }
+        EXPECT_EQ(inotifyWatcher.getWatchingPaths(subscriber3).size(), 1);
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(waitForDataChange());
+    ctx.run();
+}
+
+TEST_F(WatchRegistryTest, TestRenamePairedAsMove)
+{
+    using data_sync::watch::DataOps;
+
+    sdbusplus::async::context ctx;
+    inotify::WatchRegistry registry(ctx, IN_NONBLOCK);
+
+    std::ofstream(testDir / "dir1" / "file") << "Data";
+    std::ofstream(testDir / "dir1" / "other") << "Data";
+
+    inotify::DataWatcher dataWatcher(registry, eventMasksToWatch,
+                                     testDir / "dir1" / "");
+    dataWatcher.addPendingWatches(maxWatches);
+
+    auto subDirWd = registry.findWatch(testDir / "dir1" / "subDir");
+    ASSERT_TRUE(subDirWd.has_value());
+
+    // Renamed inside, renamed directory and moved out of the configured path
+    fs::rename(testDir / "dir1" / "file", testDir / "dir1" / "file.1");
+    fs::rename(testDir / "dir1" / "subDir", testDir / "dir1" / "newSubDir");
+    fs::rename(testDir / "dir1" / "other", testDir / "other");
+
+    // NOLINTNEXTLINE
+    auto waitForDataChange = [&]() -> sdbusplus::async::task<void> {
+        // NOLINTNEXTLINE
+        auto dataOperations = co_await dataWatcher.onDataChange();
+
+        EXPECT_EQ(dataOperations.size(), 3);
+        if (dataOperations.size() == 3)
+        {
+            EXPECT_EQ(dataOperations[0]._dataOp, DataOps::MOVE);
+            EXPECT_EQ(dataOperations[0]._path, testDir / "dir1" / "file.1");
+            EXPECT_EQ(dataOperations[0]._movedFromPath,
+                      testDir / "dir1" / "file");
+
+            EXPECT_EQ(dataOperations[1]._dataOp, DataOps::MOVE);
+            EXPECT_EQ(dataOperations[1]._path, testDir / "dir1" / "newSubDir");
+
+            // Not paired within the received events
+            EXPECT_EQ(dataOperations[2]._dataOp, DataOps::DELETE);
+            EXPECT_EQ(dataOperations[2]._path, testDir / "dir1" / "other");
+        }
+
+        // The watch of the renamed directory is kept with the new path
+        EXPECT_EQ(registry.getPath(*subDirWd),
+                  testDir / "dir1" / "newSubDir" / "");
+
+        ctx.request_stop();
+        co_return;
+    };
+
+    ctx.spawn(waitForDataChange());
+    ctx.run();
+}
+
+TEST_F(WatchRegistryTest, TestQueuedEventsLimitRaisedUptoMaximum)
+{
+    auto sysctlPath = testDir / "max_queued_events";
+    std::ofstream(sysctlPath) << MAX_QUEUED_EVENTS_LIMIT / 2 + 1;
+
+    auto readLimit = [&sysctlPath]() {
+        uint64_t limit{0};
+        std::ifstream(sysctlPath) >> limit;
+        return limit;
+    };
+
+    // Doubled, but not beyond the maximum
+    EXPECT_TRUE(data_sync::utility::raiseQueuedEventsLimit(sysctlPath));
+    EXPECT_EQ(readLimit(), MAX_QUEUED_EVENTS_LIMIT);
+
+    // Already at the maximum
+    EXPECT_FALSE(data_sync::utility::raiseQueuedEventsLimit(sysctlPath));
+    EXPECT_EQ(readLimit(), MAX_QUEUED_EVENTS_LIMIT);
+
+    // Not able to read the limit
+    EXPECT_FALSE(
+        data_sync::utility::raiseQueuedEventsLimit(testDir / "nonexistent"));
+}